@@ -0,0 +1,193 @@
+#ifndef AGENTGRID_H
+#define AGENTGRID_H
+
+#include <cmath>
+#include <vector>
+#include "DeliveryAgent.h"
+#include "HashTable.h"
+
+using namespace std;
+
+// ============================================================================
+// AGENT GRID - Spatial index of free delivery agents
+// ============================================================================
+// The plane is cut into square cells (2 km by default, the size of one
+// Islamabad sector, so each cell is in effect a per-sector free list).
+// Only cells that have held an agent exist, stored in a HashTable keyed by
+// cell coordinates. Each agent remembers its cell and its slot in that
+// cell's array, so insert and remove are O(1).
+//
+// nearest() looks at the query's own cell, then rings of cells around it,
+// and stops once the next ring cannot hold anything closer than the best
+// agent found. With agents spread over the city that is a few cells per
+// query, whatever the total number of agents.
+//
+// The cell size has to suit the coordinate units: 2 km cells on a map in
+// metres or microdegrees are tiny, and a query would walk millions of empty
+// cells. So nearest() gives up once it has probed more cells than a scan of
+// every agent would cost, and the caller scans its free list instead. A
+// probe is a hash lookup, which costs about as much as checking 16 agents,
+// so a query that gives up costs at most about twice the plain scan.
+
+class AgentGrid {
+private:
+    // std::hash<long long> is the identity, and the table masks off low
+    // bits, so packed (x, y) keys need mixing first
+    struct CellHash {
+        size_t operator()(long long key) const {
+            unsigned long long h = (unsigned long long)key * 0x9E3779B97F4A7C15ULL;
+            return (size_t)(h ^ (h >> 29));
+        }
+    };
+
+    // nearest() gives up after size() / AGENTS_PER_PROBE + MIN_CELLS probes
+    static const int AGENTS_PER_PROBE = 16;
+    static const int MIN_CELLS = 64;
+
+    double cellSize;
+    HashTable<long long, vector<DeliveryAgent*>, CellHash> cells;
+    int count;
+    int minCx, maxCx, minCy, maxCy;   // Bounding box of cells ever used
+
+    static long long cellKey(int cx, int cy) {
+        return ((long long)cx << 32) | (unsigned int)cy;
+    }
+
+    int cellOf(double v) const {
+        return (int)floor(v / cellSize);
+    }
+
+    // Squared distance from v to the span [lo, lo + cellSize) along one axis
+    double gapSq(double v, int c) const {
+        double lo = c * cellSize;
+        double d = v < lo ? lo - v : (v > lo + cellSize ? v - lo - cellSize : 0);
+        return d * d;
+    }
+
+    void scanCell(int cx, int cy, double x, double y, DeliveryAgent*& best, double& bestSq) const {
+        if (best && gapSq(x, cx) + gapSq(y, cy) >= bestSq) return; // Whole cell too far
+        const vector<DeliveryAgent*>* cell = cells.find(cellKey(cx, cy));
+        if (!cell) return;
+        for (size_t i = 0; i < cell->size(); i++) {
+            DeliveryAgent* a = (*cell)[i];
+            double dx = a->getX() - x;
+            double dy = a->getY() - y;
+            double d = dx * dx + dy * dy;
+            if (!best || d < bestSq) {
+                best = a;
+                bestSq = d;
+            }
+        }
+    }
+
+public:
+    // cell is in the units of the agents' x and y (2 km sectors by default)
+    explicit AgentGrid(double cell = 2.0)
+        : cellSize(cell > 0 ? cell : 2.0), count(0), minCx(0), maxCx(-1), minCy(0), maxCy(-1) {}
+
+    double getCellSize() const {
+        return cellSize;
+    }
+
+    // Index a at (a->getX(), a->getY()); it must not be indexed already
+    void insert(DeliveryAgent* a) {
+        int cx = cellOf(a->getX());
+        int cy = cellOf(a->getY());
+        if (count == 0 && maxCx < minCx) {
+            minCx = maxCx = cx;
+            minCy = maxCy = cy;
+        }
+        if (cx < minCx) minCx = cx;
+        if (cx > maxCx) maxCx = cx;
+        if (cy < minCy) minCy = cy;
+        if (cy > maxCy) maxCy = cy;
+
+        vector<DeliveryAgent*>& cell = cells[cellKey(cx, cy)];
+        a->gridCell = cellKey(cx, cy);
+        a->gridSlot = (int)cell.size();
+        cell.push_back(a);
+        count++;
+    }
+
+    // No-op if a is not indexed
+    void remove(DeliveryAgent* a) {
+        if (a->gridSlot < 0) return;
+        vector<DeliveryAgent*>* cell = cells.find(a->gridCell);
+        if (!cell) return;
+        DeliveryAgent* last = cell->back();
+        (*cell)[a->gridSlot] = last;
+        last->gridSlot = a->gridSlot;
+        cell->pop_back();
+        a->gridSlot = -1;
+        count--;
+    }
+
+    bool contains(const DeliveryAgent* a) const {
+        return a->gridSlot >= 0;
+    }
+
+    // Closest indexed agent by straight-line distance, nullptr if none.
+    // Also nullptr, with gaveUp set, when the cells are so small next to the
+    // gaps between agents that the ring search passed its probe limit.
+    DeliveryAgent* nearest(double x, double y, bool& gaveUp) const {
+        gaveUp = false;
+        if (count == 0) return nullptr;
+        int cx = cellOf(x);
+        int cy = cellOf(y);
+        int probesLeft = count / AGENTS_PER_PROBE + MIN_CELLS;
+
+        // Past this ring there are no cells at all
+        int maxRing = 0;
+        if (cx - minCx > maxRing) maxRing = cx - minCx;
+        if (maxCx - cx > maxRing) maxRing = maxCx - cx;
+        if (cy - minCy > maxRing) maxRing = cy - minCy;
+        if (maxCy - cy > maxRing) maxRing = maxCy - cy;
+
+        // Distance from the query to the nearest edge of its own cell
+        double edge = x - cx * cellSize;
+        if ((cx + 1) * cellSize - x < edge) edge = (cx + 1) * cellSize - x;
+        if (y - cy * cellSize < edge) edge = y - cy * cellSize;
+        if ((cy + 1) * cellSize - y < edge) edge = (cy + 1) * cellSize - y;
+
+        DeliveryAgent* best = nullptr;
+        double bestSq = 0;
+        for (int r = 0; r <= maxRing; r++) {
+            // Everything in ring r is at least edge + (r - 1) cells away
+            if (best && r > 0) {
+                double reach = edge + (r - 1) * cellSize;
+                if (reach * reach >= bestSq) break;
+            }
+            // Only the parts of the ring inside the bounding box
+            probesLeft--;
+            int loX = cx - r < minCx ? minCx : cx - r;
+            int hiX = cx + r > maxCx ? maxCx : cx + r;
+            int loY = cy - r + 1 < minCy ? minCy : cy - r + 1;
+            int hiY = cy + r - 1 > maxCy ? maxCy : cy + r - 1;
+            bool bottom = cy - r >= minCy && cy - r <= maxCy;
+            bool top = r > 0 && cy + r >= minCy && cy + r <= maxCy;
+            bool left = r > 0 && cx - r >= minCx && cx - r <= maxCx;
+            bool right = r > 0 && cx + r >= minCx && cx + r <= maxCx;
+            for (int px = loX; (bottom || top) && px <= hiX; px++) {
+                if (bottom) scanCell(px, cy - r, x, y, best, bestSq);
+                if (top) scanCell(px, cy + r, x, y, best, bestSq);
+                probesLeft -= (bottom ? 1 : 0) + (top ? 1 : 0);
+            }
+            for (int py = loY; (left || right) && py <= hiY; py++) {
+                if (left) scanCell(cx - r, py, x, y, best, bestSq);
+                if (right) scanCell(cx + r, py, x, y, best, bestSq);
+                probesLeft -= (left ? 1 : 0) + (right ? 1 : 0);
+            }
+            if (probesLeft < 0) {
+                gaveUp = true;
+                return nullptr;
+            }
+        }
+        return best;
+    }
+
+    int size() const {
+        return count;
+    }
+};
+
+#endif
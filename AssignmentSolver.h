@@ -0,0 +1,292 @@
+#ifndef ASSIGNMENTSOLVER_H
+#define ASSIGNMENTSOLVER_H
+
+#include <algorithm>
+#include <climits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// ============================================================================
+// ASSIGNMENT SOLVER - Cheapest one-to-one matching of orders to agents
+// ============================================================================
+// Input is a rows x cols cost table (cost[i * cols + j], e.g. km from agent
+// j to the restaurant of order i). The result pairs every row with its own
+// column, or with none when there are more rows than columns, so that the
+// total cost is as small as possible. Cells equal to FORBIDDEN (no route)
+// are only used when nothing else is possible, and are reported as
+// unassigned.
+//
+//   hungarian() - shortest augmenting paths with potentials, O(n^2 m) for
+//                 n = min(rows, cols), m = max. Exact, best for small batches.
+//   auction()   - Bertsekas' auction with epsilon scaling: rows bid for
+//                 their best column and raise its price until nobody wants
+//                 to switch. Costs are scaled by (m + 1) so the final
+//                 epsilon of 1 makes the result exact.
+//   solve()     - auction for big batches with about as many agents as
+//                 orders, Hungarian otherwise.
+//
+// When columns far outnumber rows, only columns among some row's n cheapest
+// are kept: a row matched anywhere else could always move to a free column
+// among those at no extra cost, so nothing optimal is lost.
+
+class AssignmentSolver {
+public:
+    static constexpr int FORBIDDEN = INT_MAX;
+    static constexpr int HUNGARIAN_LIMIT = 200;   // Smaller side; see solve()
+
+private:
+    // Working copy: n <= m, candidate columns only, FORBIDDEN replaced by a
+    // penalty larger than any all-allowed assignment
+    struct Problem {
+        int n, m;
+        bool transposed;
+        vector<int> columnOf;      // Working column -> original row/col
+        vector<long long> cost;    // n x m
+        long long penalty;
+    };
+
+    static void prepare(const vector<int>& cost, int rows, int cols, Problem& p) {
+        p.transposed = rows > cols;
+        p.n = p.transposed ? cols : rows;
+        int m = p.transposed ? rows : cols;
+
+        // at(i, j) in the n <= m orientation
+        auto at = [&](int i, int j) -> int {
+            return p.transposed ? cost[(size_t)j * cols + i] : cost[(size_t)i * cols + j];
+        };
+
+        long long maxCost = 0;
+        for (size_t k = 0; k < cost.size(); k++) {
+            if (cost[k] != FORBIDDEN && cost[k] > maxCost) maxCost = cost[k];
+        }
+        p.penalty = (maxCost + 1) * (p.n + 1);
+
+        vector<char> keep(m, 1);
+        if (m > 2 * p.n) {
+            keep.assign(m, 0);
+            vector<int> order(m);
+            for (int i = 0; i < p.n; i++) {
+                for (int j = 0; j < m; j++) order[j] = j;
+                nth_element(order.begin(), order.begin() + (p.n - 1), order.end(),
+                            [&](int a, int b) { return at(i, a) < at(i, b); });
+                for (int k = 0; k < p.n; k++) keep[order[k]] = 1;
+            }
+        }
+        p.columnOf.clear();
+        for (int j = 0; j < m; j++) {
+            if (keep[j]) p.columnOf.push_back(j);
+        }
+        p.m = (int)p.columnOf.size();
+
+        p.cost.resize((size_t)p.n * p.m);
+        for (int i = 0; i < p.n; i++) {
+            for (int j = 0; j < p.m; j++) {
+                int c = at(i, p.columnOf[j]);
+                p.cost[(size_t)i * p.m + j] = c == FORBIDDEN ? p.penalty : c;
+            }
+        }
+    }
+
+    // rowCol[i] = working column of working row i -> result in original shape
+    static long long finish(const vector<int>& cost, int rows, int cols, const Problem& p,
+                            const vector<int>& rowCol, vector<int>& assignment) {
+        assignment.assign(rows, -1);
+        long long total = 0;
+        for (int i = 0; i < p.n; i++) {
+            if (rowCol[i] < 0) continue;
+            int r = p.transposed ? p.columnOf[rowCol[i]] : i;
+            int c = p.transposed ? i : p.columnOf[rowCol[i]];
+            int value = cost[(size_t)r * cols + c];
+            if (value == FORBIDDEN) continue;
+            assignment[r] = c;
+            total += value;
+        }
+        return total;
+    }
+
+    static void runHungarian(const Problem& p, vector<int>& rowCol) {
+        int n = p.n, m = p.m;
+        const long long INF = LLONG_MAX / 4;
+        // 1-based: column 0 is the virtual start of each augmenting path
+        vector<long long> u(n + 1, 0), v(m + 1, 0), minv(m + 1);
+        vector<int> owner(m + 1, 0), way(m + 1, 0);
+        vector<char> used(m + 1);
+
+        for (int i = 1; i <= n; i++) {
+            owner[0] = i;
+            int j0 = 0;
+            minv.assign(m + 1, INF);
+            used.assign(m + 1, 0);
+            do {
+                used[j0] = 1;
+                int i0 = owner[j0];
+                long long delta = INF;
+                int j1 = 0;
+                const long long* row = &p.cost[(size_t)(i0 - 1) * m];
+                for (int j = 1; j <= m; j++) {
+                    if (used[j]) continue;
+                    long long cur = row[j - 1] - u[i0] - v[j];
+                    if (cur < minv[j]) {
+                        minv[j] = cur;
+                        way[j] = j0;
+                    }
+                    if (minv[j] < delta) {
+                        delta = minv[j];
+                        j1 = j;
+                    }
+                }
+                for (int j = 0; j <= m; j++) {
+                    if (used[j]) {
+                        u[owner[j]] += delta;
+                        v[j] -= delta;
+                    } else {
+                        minv[j] -= delta;
+                    }
+                }
+                j0 = j1;
+            } while (owner[j0] != 0);
+            // Flip the augmenting path
+            do {
+                int j1 = way[j0];
+                owner[j0] = owner[j1];
+                j0 = j1;
+            } while (j0 != 0);
+        }
+
+        rowCol.assign(n, -1);
+        for (int j = 1; j <= m; j++) {
+            if (owner[j] != 0) rowCol[owner[j] - 1] = j - 1;
+        }
+    }
+
+    static void runAuction(const Problem& p, vector<int>& rowCol) {
+        int n = p.n, m = p.m;
+        // Square it up with m - n bidders that value every column at 0; they
+        // soak up the columns nobody needs. Benefits are negated, scaled costs.
+        long long scale = m + 1;
+        long long maxBenefit = 0;
+        for (size_t k = 0; k < p.cost.size(); k++) {
+            if (p.cost[k] * scale > maxBenefit) maxBenefit = p.cost[k] * scale;
+        }
+
+        vector<long long> price(m, 0);
+        vector<int> owner(m), assigned(m);
+        vector<int> unassigned;
+        unassigned.reserve(m);
+
+        // Dummy bidders only want the cheapest columns: a min-heap of
+        // (price, column) answers them in O(log m). Entries go stale when a
+        // price rises and are skipped (prices only rise within a phase).
+        vector<pair<long long, int>> cheapest;
+        auto cheaper = [](const pair<long long, int>& a, const pair<long long, int>& b) {
+            return a.first > b.first;
+        };
+        auto dropStale = [&]() {
+            while (!cheapest.empty() && cheapest.front().first != price[cheapest.front().second]) {
+                pop_heap(cheapest.begin(), cheapest.end(), cheaper);
+                cheapest.pop_back();
+            }
+        };
+
+        long long eps = maxBenefit / 4;
+        if (eps < 1) eps = 1;
+        for (;;) {
+            for (int j = 0; j < m; j++) owner[j] = -1;
+            for (int i = 0; i < m; i++) assigned[i] = -1;
+            unassigned.clear();
+            for (int i = m - 1; i >= 0; i--) unassigned.push_back(i);
+            cheapest.clear();
+            for (int j = 0; j < m; j++) cheapest.push_back(make_pair(price[j], j));
+            make_heap(cheapest.begin(), cheapest.end(), cheaper);
+
+            while (!unassigned.empty()) {
+                int i = unassigned.back();
+                unassigned.pop_back();
+
+                // Best and second-best value (benefit - price) over all columns
+                long long best = LLONG_MIN, second = LLONG_MIN;
+                int bestCol = 0;
+                if (i < n) {
+                    const long long* row = &p.cost[(size_t)i * m];
+                    for (int j = 0; j < m; j++) {
+                        long long value = -row[j] * scale - price[j];
+                        if (value > best) {
+                            second = best;
+                            best = value;
+                            bestCol = j;
+                        } else if (value > second) {
+                            second = value;
+                        }
+                    }
+                } else {
+                    dropStale();
+                    pair<long long, int> top = cheapest.front();
+                    pop_heap(cheapest.begin(), cheapest.end(), cheaper);
+                    cheapest.pop_back();
+                    dropStale();
+                    best = -top.first;
+                    bestCol = top.second;
+                    if (!cheapest.empty()) second = -cheapest.front().first;
+                }
+                long long raise = second == LLONG_MIN ? eps : best - second + eps;
+                price[bestCol] += raise;
+                cheapest.push_back(make_pair(price[bestCol], bestCol));
+                push_heap(cheapest.begin(), cheapest.end(), cheaper);
+                int previous = owner[bestCol];
+                if (previous >= 0) {
+                    assigned[previous] = -1;
+                    unassigned.push_back(previous);
+                }
+                owner[bestCol] = i;
+                assigned[i] = bestCol;
+            }
+
+            if (eps == 1) break;
+            eps /= 4;
+            if (eps < 1) eps = 1;
+        }
+
+        rowCol.assign(assigned.begin(), assigned.begin() + n);
+    }
+
+public:
+    // assignment[i] = column matched to row i, or -1; returns the total cost
+    static long long hungarian(const vector<int>& cost, int rows, int cols, vector<int>& assignment) {
+        if (rows <= 0 || cols <= 0) {
+            assignment.assign(rows > 0 ? rows : 0, -1);
+            return 0;
+        }
+        Problem p;
+        prepare(cost, rows, cols, p);
+        vector<int> rowCol;
+        runHungarian(p, rowCol);
+        return finish(cost, rows, cols, p, rowCol, assignment);
+    }
+
+    static long long auction(const vector<int>& cost, int rows, int cols, vector<int>& assignment) {
+        if (rows <= 0 || cols <= 0) {
+            assignment.assign(rows > 0 ? rows : 0, -1);
+            return 0;
+        }
+        Problem p;
+        prepare(cost, rows, cols, p);
+        vector<int> rowCol;
+        runAuction(p, rowCol);
+        return finish(cost, rows, cols, p, rowCol, assignment);
+    }
+
+    // Auction only for large, nearly square batches; with spare columns the
+    // Hungarian method's augmenting paths stay short and it wins
+    static long long solve(const vector<int>& cost, int rows, int cols, vector<int>& assignment) {
+        int n = rows < cols ? rows : cols;
+        int m = rows < cols ? cols : rows;
+        if (n > HUNGARIAN_LIMIT && (long long)(m - n) * 20 <= n) {
+            return auction(cost, rows, cols, assignment);
+        }
+        return hungarian(cost, rows, cols, assignment);
+    }
+};
+
+#endif
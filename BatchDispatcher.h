@@ -0,0 +1,303 @@
+#ifndef BATCHDISPATCHER_H
+#define BATCHDISPATCHER_H
+
+#include <unordered_map>
+#include <vector>
+#include "AssignmentSolver.h"
+#include "DeliveryManager.h"
+#include "DistanceTable.h"
+#include "Graph.h"
+#include "OrderManager.h"
+#include "RestaurantManager.h"
+#include "RoutePlanner.h"
+
+using namespace std;
+
+// ============================================================================
+// BATCH DISPATCHER - Assign a window of orders to agents all at once
+// ============================================================================
+// Handing each order to the closest free agent as it arrives can leave the
+// next order with a far worse choice than a swap would have cost. At peak
+// times orders are collected from the OrderManager for a short window
+// instead (up to maxBatch orders or windowSeconds, whichever comes first),
+// and the whole batch is matched to the free agents in one go with the
+// smallest total road distance (AssignmentSolver). Road distances come from
+// one DistanceTable over the distinct agent and restaurant sectors.
+//
+// Only agents with a known sector take part. An order whose restaurant has
+// no sector costs the same with every agent. Orders that get no agent (not
+// enough agents, or no road) stay pending for the next window.
+//
+// Time is whatever clock the caller uses (seconds of wall time, simulated
+// minutes, ...); the dispatcher only compares differences.
+
+class BatchDispatcher {
+private:
+    OrderManager* orders;
+    RestaurantManager* restaurants;
+    DeliveryManager* agents;
+    Graph* map;
+
+    int maxBatch;
+    double windowSeconds;
+    double windowStart;
+    vector<Order> pending;
+
+    DistanceTable table;
+    long long lastCost;
+    int lastAssigned;
+
+public:
+    BatchDispatcher(OrderManager& om, RestaurantManager& rm, DeliveryManager& dm, Graph& g,
+                    int maxBatch = 32, double windowSeconds = 30.0)
+        : orders(&om), restaurants(&rm), agents(&dm), map(&g),
+          maxBatch(maxBatch > 0 ? maxBatch : 1), windowSeconds(windowSeconds), windowStart(0),
+          lastCost(0), lastAssigned(0) {}
+
+    void setWindow(int newMaxBatch, double newWindowSeconds) {
+        maxBatch = newMaxBatch > 0 ? newMaxBatch : 1;
+        windowSeconds = newWindowSeconds;
+    }
+
+    // Move every queued order into the current window; returns how many
+    int collect(double now) {
+        int taken = 0;
+        Order o;
+        while (orders->tryGetNextOrder(o)) {
+            if (pending.empty()) windowStart = now;
+            pending.push_back(std::move(o));
+            taken++;
+        }
+        return taken;
+    }
+
+    // Window full or expired
+    bool due(double now) const {
+        if (pending.empty()) return false;
+        return (int)pending.size() >= maxBatch || now - windowStart >= windowSeconds;
+    }
+
+    // Match pending orders to free agents; returns the number assigned
+    int dispatch(double now) {
+        lastCost = 0;
+        lastAssigned = 0;
+        if (pending.empty()) return 0;
+
+        vector<DeliveryAgent*> free;
+        for (DeliveryAgent* a = agents->getAvailableAgent(); a; a = a->nextAvailable()) {
+            if (a->getSector() >= 0) free.push_back(a);
+        }
+        if (free.empty()) {
+            Display::printError("No delivery agents available!");
+            windowStart = now;
+            return 0;
+        }
+
+        // Distinct sectors on each side, and each order/agent's index into them
+        int V = map->getNumVertices();
+        vector<int> sourceIndex(V, -1), targetIndex(V, -1);
+        vector<int> sources, targets;
+        vector<int> agentRow(free.size()), orderCol(pending.size(), -1);
+        for (size_t j = 0; j < free.size(); j++) {
+            int s = free[j]->getSector();
+            if (s >= V) {
+                agentRow[j] = -1;
+                continue;
+            }
+            if (sourceIndex[s] < 0) {
+                sourceIndex[s] = (int)sources.size();
+                sources.push_back(s);
+            }
+            agentRow[j] = sourceIndex[s];
+        }
+        for (size_t i = 0; i < pending.size(); i++) {
+            Restaurant* r = restaurants->getRestaurant(pending[i].restaurantID);
+            if (!r || r->sector < 0 || r->sector >= V) continue;
+            if (targetIndex[r->sector] < 0) {
+                targetIndex[r->sector] = (int)targets.size();
+                targets.push_back(r->sector);
+            }
+            orderCol[i] = targetIndex[r->sector];
+        }
+        DISPLAY_SYSTEM_LOG("Computing agent-to-restaurant distance table...");
+        if (!table.compute(*map, sources, targets)) return 0;
+
+        // cost[i * agents + j]: order i picked up by agent j
+        int rows = (int)pending.size();
+        int cols = (int)free.size();
+        vector<int> cost((size_t)rows * cols);
+        for (int i = 0; i < rows; i++) {
+            for (int j = 0; j < cols; j++) {
+                int c;
+                if (agentRow[j] < 0) c = AssignmentSolver::FORBIDDEN;
+                else if (orderCol[i] < 0) c = 0;
+                else {
+                    c = table.at(agentRow[j], orderCol[i]);
+                    if (c == DistanceTable::UNREACHABLE) c = AssignmentSolver::FORBIDDEN;
+                }
+                cost[(size_t)i * cols + j] = c;
+            }
+        }
+
+        DISPLAY_SYSTEM_LOG("Solving min-cost assignment of orders to agents...");
+        vector<int> match;
+        lastCost = AssignmentSolver::solve(cost, rows, cols, match);
+
+        vector<Order> leftover;
+        for (int i = 0; i < rows; i++) {
+            if (match[i] >= 0 && agents->assignTo(free[match[i]], std::move(pending[i]))) {
+                lastAssigned++;
+            } else {
+                leftover.push_back(std::move(pending[i]));
+            }
+        }
+        pending.swap(leftover);
+        if (!pending.empty()) windowStart = now;
+        return lastAssigned;
+    }
+
+    // Like dispatch(), but an agent may carry several orders: new orders are
+    // chained into routes for free agents (RoutePlanner::plan) and whatever
+    // no free agent takes is inserted into routes already being driven.
+    // Orders need a restaurant sector and a deliverySector; the rest wait
+    // for dispatch(). Returns the number of orders put on routes.
+    int dispatchRoutes(double now, RoutePlanner& planner) {
+        lastCost = 0;
+        lastAssigned = 0;
+        if (pending.empty()) return 0;
+        int V = map->getNumVertices();
+
+        // Jobs for the new orders; jobOrder[j] = index into pending
+        vector<DeliveryJob> jobs;
+        vector<int> jobOrder;
+        vector<string> jobId;
+        for (size_t i = 0; i < pending.size(); i++) {
+            Restaurant* r = restaurants->getRestaurant(pending[i].restaurantID);
+            int drop = pending[i].deliverySector;
+            if (!r || r->sector < 0 || r->sector >= V || drop < 0 || drop >= V) continue;
+            jobs.push_back({r->sector, drop});
+            jobOrder.push_back((int)i);
+            jobId.push_back(pending[i].orderID);
+        }
+        int newJobs = (int)jobs.size();
+        if (newJobs == 0) return 0;
+
+        vector<DeliveryAgent*> free;
+        vector<int> starts;
+        for (DeliveryAgent* a = agents->getAvailableAgent(); a; a = a->nextAvailable()) {
+            if (a->getSector() >= 0 && a->getSector() < V) {
+                free.push_back(a);
+                starts.push_back(a->getSector());
+            }
+        }
+
+        DISPLAY_SYSTEM_LOG("Chaining orders into routes (savings + local search)...");
+        vector<PlannedRoute> planned;
+        planner.plan(jobs, starts, planned);
+
+        // Every route that can still change, with the agent driving it
+        vector<PlannedRoute> routes;
+        vector<DeliveryAgent*> routeAgent;
+        vector<int> unplaced;
+        for (size_t r = 0; r < planned.size(); r++) {
+            if (planned[r].agent >= 0) {
+                routeAgent.push_back(free[planned[r].agent]);
+                routes.push_back(planned[r]);
+            } else {
+                for (size_t k = 0; k < planned[r].stops.size(); k++) {
+                    if (planned[r].stops[k].pickup) unplaced.push_back(planned[r].stops[k].job);
+                }
+            }
+        }
+        int firstExisting = (int)routes.size();
+        unordered_map<string, int> existingJob;   // Order ID -> job, for orders already on routes
+        vector<DeliveryAgent*> busy = agents->getRoutedAgents();
+        for (size_t b = 0; b < busy.size(); b++) {
+            DeliveryAgent* a = busy[b];
+            if (a->getSector() < 0 || a->getSector() >= V) continue;
+            // Already-assigned orders become jobs too, so stops can be reordered
+            PlannedRoute route;
+            route.start = a->getSector();
+            route.locked = 1;   // Already driving to the first stop
+            for (size_t k = 0; k < a->getRoute().size(); k++) {
+                const RouteStop& stop = a->getRoute()[k];
+                int job;
+                unordered_map<string, int>::const_iterator found = existingJob.find(stop.orderID);
+                if (found != existingJob.end()) {
+                    job = found->second;
+                } else {
+                    job = (int)jobs.size();
+                    jobs.push_back({stop.sector, stop.sector});
+                    jobOrder.push_back(-1);
+                    jobId.push_back(stop.orderID);
+                    existingJob[stop.orderID] = job;
+                }
+                if (stop.pickup) jobs[job].pickup = stop.sector;
+                else jobs[job].dropoff = stop.sector;
+                route.stops.push_back({stop.sector, job, stop.pickup});
+            }
+            planner.routeCost(route);
+            routeAgent.push_back(a);
+            routes.push_back(route);
+        }
+        vector<char> changed(routes.size(), 0);
+        for (int r = 0; r < firstExisting; r++) changed[r] = 1;
+        for (size_t u = 0; u < unplaced.size(); u++) {
+            int r = planner.insert(jobs, unplaced[u], routes);
+            if (r >= 0) changed[r] = 1;
+        }
+
+        // Hand the new and changed routes to their agents
+        vector<char> assigned(pending.size(), 0);
+        for (size_t r = 0; r < routes.size(); r++) {
+            if (!changed[r]) continue;
+            vector<Order> orders;
+            vector<RouteStop> stops;
+            vector<int> placed;
+            for (size_t k = 0; k < routes[r].stops.size(); k++) {
+                const PlannedStop& ps = routes[r].stops[k];
+                stops.push_back({ps.node, ps.pickup, jobId[ps.job]});
+                int i = jobOrder[ps.job];
+                if (ps.pickup && i >= 0) {
+                    orders.push_back(pending[i]);
+                    placed.push_back(i);
+                }
+            }
+            if (agents->assignRoute(routeAgent[r], std::move(orders), std::move(stops))) {
+                for (size_t k = 0; k < placed.size(); k++) assigned[placed[k]] = 1;
+                lastAssigned += (int)placed.size();
+                lastCost += routes[r].cost;
+            }
+        }
+
+        vector<Order> leftover;
+        for (size_t i = 0; i < pending.size(); i++) {
+            if (!assigned[i]) leftover.push_back(std::move(pending[i]));
+        }
+        pending.swap(leftover);
+        if (!pending.empty()) windowStart = now;
+        return lastAssigned;
+    }
+
+    // collect() and dispatch() if the window is due; returns orders assigned
+    int tick(double now) {
+        collect(now);
+        return due(now) ? dispatch(now) : 0;
+    }
+
+    int pendingCount() const {
+        return (int)pending.size();
+    }
+
+    // Total road distance of the last dispatch() (sum over assigned orders),
+    // or of the routes handed out by the last dispatchRoutes()
+    long long lastBatchCost() const {
+        return lastCost;
+    }
+
+    int lastBatchAssigned() const {
+        return lastAssigned;
+    }
+};
+
+#endif
@@ -0,0 +1,751 @@
+#ifndef CONTRACTIONHIERARCHY_H
+#define CONTRACTIONHIERARCHY_H
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Graph.h"
+#include "IndexedHeap.h"
+#include "ShortestPathEngine.h"
+#include "Display.h"
+
+using namespace std;
+
+// ============================================================================
+// CONTRACTION HIERARCHIES - Preprocessed point-to-point routing
+// ============================================================================
+// Preprocessing removes ("contracts") vertices one at a time, least
+// important first. When v is removed, every route u -> v -> x that has no
+// equally short detour (a "witness") is kept as a shortcut arc u -> x that
+// remembers v as its middle vertex. The order of removal is each vertex's
+// rank.
+//
+// A query then only ever climbs: a forward search from the source uses arcs
+// to higher-ranked vertices, and a backward search from the destination
+// does the same on reversed arcs. Every shortest route has a highest vertex
+// where the two meet, so both searches stay tiny even on city-sized maps.
+// Shortcuts are unpacked through their middle vertices to give the real path.
+//
+// build() is slow (minutes for 100k+ vertices on one core), so the result
+// can be saved to a binary file and loaded at startup instead.
+
+class ContractionHierarchy {
+public:
+    static constexpr int UNREACHABLE = ShortestPathEngine::UNREACHABLE;
+
+private:
+    // Arc used while contracting; mid = -1 for an original road
+    struct Arc {
+        int to;
+        int weight;
+        int mid;
+    };
+
+    // Upward arcs in CSR form. up: u -> to with rank[to] > rank[u].
+    // down: stored at v for an original arc from -> v with rank[from] > rank[v],
+    // so the backward search can climb it in reverse.
+    struct UpwardGraph {
+        vector<int> offsets;
+        vector<int> dests;
+        vector<int> weights;
+        vector<int> mids;
+    };
+
+    int numVertices;
+    bool directed;
+    vector<int> rank;
+    UpwardGraph up;
+    UpwardGraph down;
+    int numShortcuts;
+
+    // Fingerprint of the map this was built from, see matches()
+    int mapArcs;
+    unsigned long long mapChecksum;
+
+    // Query scratch, stamped like ShortestPathEngine so nothing is cleared per query
+    vector<int> fwdDist, bwdDist;
+    vector<int> fwdParent, bwdParent;   // Previous / next vertex on the route
+    vector<int> fwdMid, bwdMid;         // Middle vertex of the arc used to get here
+    vector<unsigned int> fwdSeen, bwdSeen;
+    unsigned int generation;
+    IndexedHeap<int>* fwdPq;
+    IndexedHeap<int>* bwdPq;
+    int settledCount;
+
+    // Many-to-many buckets: bucket[v] holds (target column, distance v -> target)
+    vector<vector<pair<int, int> > > bucket;
+    vector<int> climbed;                // Vertices settled by the last climb()
+
+    // ---------- preprocessing helpers ----------
+
+    // Add or shorten the arc from -> to in list
+    static void addArc(vector<Arc>& list, int to, int weight, int mid) {
+        for (size_t i = 0; i < list.size(); i++) {
+            if (list[i].to == to) {
+                if (weight < list[i].weight) {
+                    list[i].weight = weight;
+                    list[i].mid = mid;
+                }
+                return;
+            }
+        }
+        Arc a = {to, weight, mid};
+        list.push_back(a);
+    }
+
+    static void removeArc(vector<Arc>& list, int to) {
+        for (size_t i = 0; i < list.size(); i++) {
+            if (list[i].to == to) {
+                list[i] = list.back();
+                list.pop_back();
+                return;
+            }
+        }
+    }
+
+    // Working state for build()
+    struct Builder {
+        vector<vector<Arc> > out;
+        vector<vector<Arc> > in;
+        vector<int> contractedNeighbours;
+        vector<int> level;              // 1 + highest level of a contracted neighbour
+        vector<int> touchedBy;          // Last contracted vertex that re-scored this one
+        vector<int> witnessDist;
+        vector<unsigned int> witnessSeen;
+        unsigned int witnessGeneration;
+        vector<int> isTarget;           // isTarget[x] == v: x is an out-neighbour of v
+        IndexedHeap<int>* witnessPq;
+    };
+
+    // Shortest distance from u over the remaining graph without passing
+    // through 'skip', stopping once all 'targets' out-neighbours of skip are
+    // settled, or giving up past 'limit' or after maxSettles vertices.
+    // Giving up early is safe: it only adds a shortcut that was not needed.
+    static void witnessSearch(Builder& b, int u, int skip, int limit, int maxSettles, int targets) {
+        b.witnessGeneration++;
+        b.witnessPq->clear();
+        b.witnessDist[u] = 0;
+        b.witnessSeen[u] = b.witnessGeneration;
+        b.witnessPq->insert(u, 0);
+
+        int settles = 0;
+        while (!b.witnessPq->isEmpty()) {
+            int x = b.witnessPq->extractMin();
+            if (b.witnessDist[x] > limit || ++settles > maxSettles) break;
+            if (b.isTarget[x] == skip && --targets == 0) break;
+            const vector<Arc>& arcs = b.out[x];
+            for (size_t i = 0; i < arcs.size(); i++) {
+                int y = arcs[i].to;
+                if (y == skip) continue;
+                int nd = b.witnessDist[x] + arcs[i].weight;
+                if (b.witnessSeen[y] != b.witnessGeneration || nd < b.witnessDist[y]) {
+                    b.witnessSeen[y] = b.witnessGeneration;
+                    b.witnessDist[y] = nd;
+                    b.witnessPq->push(y, nd);
+                }
+            }
+        }
+    }
+
+    static int witnessDistance(const Builder& b, int x) {
+        return b.witnessSeen[x] == b.witnessGeneration ? b.witnessDist[x] : UNREACHABLE;
+    }
+
+    // Shortcuts needed to remove v; adds them unless simulate is set
+    static int contract(Builder& b, int v, bool simulate) {
+        vector<Arc>& in = b.in[v];
+        vector<Arc>& out = b.out[v];
+        int maxOut = 0;
+        for (size_t j = 0; j < out.size(); j++) {
+            if (out[j].weight > maxOut) maxOut = out[j].weight;
+            b.isTarget[out[j].to] = v;
+        }
+
+        int shortcuts = 0;
+        for (size_t i = 0; i < in.size(); i++) {
+            int u = in[i].to;
+            // Scoring only needs an estimate, so it searches less
+            witnessSearch(b, u, v, in[i].weight + maxOut, simulate ? 20 : 500, (int)out.size());
+            for (size_t j = 0; j < out.size(); j++) {
+                int x = out[j].to;
+                if (x == u) continue;
+                int viaV = in[i].weight + out[j].weight;
+                if (witnessDistance(b, x) <= viaV) continue;
+                shortcuts++;
+                if (!simulate) {
+                    addArc(b.out[u], x, viaV, v);
+                    addArc(b.in[x], u, viaV, v);
+                }
+            }
+        }
+        return shortcuts;
+    }
+
+    // Lower = contract sooner. Edge difference keeps the graph sparse;
+    // contracted neighbours and level spread contraction evenly across the
+    // map, which keeps the upward searches shallow.
+    static int priority(Builder& b, int v) {
+        int shortcuts = contract(b, v, true);
+        int removed = (int)(b.in[v].size() + b.out[v].size());
+        return 2 * (shortcuts - removed) + b.contractedNeighbours[v] + b.level[v];
+    }
+
+    // x is a neighbour of the vertex v just contracted: its arcs changed, so
+    // recompute its place in the order (once, even if linked both ways)
+    static void touchNeighbour(Builder& b, IndexedHeap<int>& order, int x, int v) {
+        if (b.touchedBy[x] == v) return;
+        b.touchedBy[x] = v;
+        b.contractedNeighbours[x]++;
+        if (b.level[x] < b.level[v] + 1) b.level[x] = b.level[v] + 1;
+        if (order.remove(x)) order.insert(x, priority(b, x));
+    }
+
+    static void toCSR(const vector<vector<Arc> >& lists, UpwardGraph& g) {
+        int n = (int)lists.size();
+        g.offsets.assign(n + 1, 0);
+        g.dests.clear();
+        g.weights.clear();
+        g.mids.clear();
+        for (int v = 0; v < n; v++) {
+            g.offsets[v] = (int)g.dests.size();
+            for (size_t i = 0; i < lists[v].size(); i++) {
+                g.dests.push_back(lists[v][i].to);
+                g.weights.push_back(lists[v][i].weight);
+                g.mids.push_back(lists[v][i].mid);
+            }
+        }
+        g.offsets[n] = (int)g.dests.size();
+    }
+
+    // ---------- query helpers ----------
+
+    void prepareScratch() {
+        fwdDist.assign(numVertices, 0);
+        bwdDist.assign(numVertices, 0);
+        fwdParent.assign(numVertices, -1);
+        bwdParent.assign(numVertices, -1);
+        fwdMid.assign(numVertices, -1);
+        bwdMid.assign(numVertices, -1);
+        fwdSeen.assign(numVertices, 0);
+        bwdSeen.assign(numVertices, 0);
+        generation = 0;
+        delete fwdPq;
+        delete bwdPq;
+        fwdPq = new IndexedHeap<int>(numVertices);
+        bwdPq = new IndexedHeap<int>(numVertices);
+    }
+
+    // Middle vertex of the arc a -> b (one end outranks the other)
+    int midOf(int a, int b) const {
+        if (rank[a] < rank[b]) {
+            for (int e = up.offsets[a]; e < up.offsets[a + 1]; e++) {
+                if (up.dests[e] == b) return up.mids[e];
+            }
+        } else {
+            for (int e = down.offsets[b]; e < down.offsets[b + 1]; e++) {
+                if (down.dests[e] == a) return down.mids[e];
+            }
+        }
+        return -1;
+    }
+
+    // Append the real vertices of arc a -> b after a (b included)
+    void unpack(int a, int b, int mid, vector<int>& path) const {
+        if (mid == -1) {
+            path.push_back(b);
+            return;
+        }
+        unpack(a, mid, midOf(a, mid), path);
+        unpack(mid, b, midOf(mid, b), path);
+    }
+
+    // Start a fresh search stamp for both sides
+    void nextGeneration() {
+        generation++;
+        if (generation == 0) {
+            fwdSeen.assign(numVertices, 0);
+            bwdSeen.assign(numVertices, 0);
+            generation = 1;
+        }
+        fwdPq->clear();
+        bwdPq->clear();
+    }
+
+    // Exhaustive one-sided upward search from start (with stalling). Fills
+    // climbed with every vertex settled at its true upward distance.
+    void climb(bool forward, int start) {
+        const UpwardGraph& g = forward ? up : down;
+        const UpwardGraph& against = forward ? down : up;
+        IndexedHeap<int>& heap = forward ? *fwdPq : *bwdPq;
+        vector<int>& d = forward ? fwdDist : bwdDist;
+        vector<unsigned int>& seen = forward ? fwdSeen : bwdSeen;
+
+        nextGeneration();
+        climbed.clear();
+        d[start] = 0;
+        seen[start] = generation;
+        heap.insert(start, 0);
+
+        while (!heap.isEmpty()) {
+            int u = heap.extractMin();
+            bool stalled = false;
+            for (int e = against.offsets[u]; e < against.offsets[u + 1] && !stalled; e++) {
+                int x = against.dests[e];
+                stalled = seen[x] == generation && (long long)d[x] + against.weights[e] < d[u];
+            }
+            if (stalled) continue;
+            climbed.push_back(u);
+
+            for (int e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+                int v = g.dests[e];
+                int nd = d[u] + g.weights[e];
+                if (seen[v] != generation || nd < d[v]) {
+                    seen[v] = generation;
+                    d[v] = nd;
+                    heap.push(v, nd);
+                }
+            }
+        }
+    }
+
+    // One settle step of one side; updates mu/meet when the sides touch
+    void step(bool forward, int& mu, int& meet) {
+        const UpwardGraph& g = forward ? up : down;
+        IndexedHeap<int>& heap = forward ? *fwdPq : *bwdPq;
+        vector<int>& d = forward ? fwdDist : bwdDist;
+        vector<int>& p = forward ? fwdParent : bwdParent;
+        vector<int>& m = forward ? fwdMid : bwdMid;
+        vector<unsigned int>& seen = forward ? fwdSeen : bwdSeen;
+        const vector<int>& otherDist = forward ? bwdDist : fwdDist;
+        const vector<unsigned int>& otherSeen = forward ? bwdSeen : fwdSeen;
+
+        int u = heap.extractMin();
+        settledCount++;
+        if (otherSeen[u] == generation && (long long)d[u] + otherDist[u] < mu) {
+            mu = d[u] + otherDist[u];
+            meet = u;
+        }
+
+        // Stall-on-demand: if a higher vertex this side already reached
+        // has a shorter way down into u, u is not on a shortest route, so
+        // don't expand it
+        const UpwardGraph& against = forward ? down : up;
+        for (int e = against.offsets[u]; e < against.offsets[u + 1]; e++) {
+            int x = against.dests[e];
+            if (seen[x] == generation && (long long)d[x] + against.weights[e] < d[u]) return;
+        }
+
+        for (int e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+            int v = g.dests[e];
+            int nd = d[u] + g.weights[e];
+            if (seen[v] != generation || nd < d[v]) {
+                // Settled vertices never improve, so this only hits open ones
+                seen[v] = generation;
+                d[v] = nd;
+                p[v] = u;
+                m[v] = g.mids[e];
+                heap.push(v, nd);
+            }
+        }
+    }
+
+    template <typename T>
+    static void writeVector(ofstream& file, const vector<T>& v) {
+        int n = (int)v.size();
+        file.write((const char*)&n, sizeof(n));
+        if (n > 0) file.write((const char*)&v[0], sizeof(T) * n);
+    }
+
+    // bytesLeft bounds the count before anything is allocated, so a bad
+    // length can't ask for gigabytes
+    template <typename T>
+    static bool readVector(ifstream& file, vector<T>& v, long long& bytesLeft) {
+        int n = 0;
+        if (!file.read((char*)&n, sizeof(n)) || n < 0) return false;
+        bytesLeft -= sizeof(n);
+        if ((long long)n * (long long)sizeof(T) > bytesLeft) return false;
+        bytesLeft -= (long long)n * sizeof(T);
+        v.resize(n);
+        if (n > 0 && !file.read((char*)&v[0], sizeof(T) * n)) return false;
+        return true;
+    }
+
+    // Everything query() and unpack() index with must be in range: offsets
+    // ascending, dests and mids real vertices, every arc climbing in rank,
+    // and a shortcut's middle vertex ranked below both ends (so unpacking
+    // always terminates)
+    static bool validUpward(const UpwardGraph& g, const vector<int>& rank, int n) {
+        if ((int)g.offsets.size() != n + 1 || g.offsets[0] != 0
+            || g.offsets[n] != (int)g.dests.size()
+            || g.weights.size() != g.dests.size() || g.mids.size() != g.dests.size()) {
+            return false;
+        }
+        for (int u = 0; u < n; u++) {
+            if (g.offsets[u] > g.offsets[u + 1]) return false;
+            for (int e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+                int to = g.dests[e];
+                int mid = g.mids[e];
+                if (to < 0 || to >= n || rank[to] <= rank[u] || g.weights[e] < 0) return false;
+                if (mid != -1 && (mid < 0 || mid >= n || rank[mid] >= rank[u])) return false;
+            }
+        }
+        return true;
+    }
+
+    // FNV-1a over the CSR arrays
+    static unsigned long long checksum(const CSRGraph& csr) {
+        unsigned long long h = 1469598103934665603ULL;
+        auto mix = [&h](int value) {
+            for (int i = 0; i < 4; i++) {
+                h ^= (unsigned char)(value >> (8 * i));
+                h *= 1099511628211ULL;
+            }
+        };
+        int V = csr.getNumVertices();
+        for (int u = 0; u < V; u++) {
+            mix(csr.arcEnd(u));
+            for (int e = csr.arcBegin(u); e < csr.arcEnd(u); e++) {
+                mix(csr.arcDest(e));
+                mix(csr.arcWeight(e));
+            }
+        }
+        return h;
+    }
+
+public:
+    ContractionHierarchy()
+        : numVertices(0), directed(false), numShortcuts(0), mapArcs(0), mapChecksum(0), generation(0),
+          fwdPq(nullptr), bwdPq(nullptr), settledCount(0) {}
+
+    ~ContractionHierarchy() {
+        delete fwdPq;
+        delete bwdPq;
+    }
+
+    ContractionHierarchy(const ContractionHierarchy&) = delete;
+    ContractionHierarchy& operator=(const ContractionHierarchy&) = delete;
+
+    // Preprocess g. Later addEdge calls are not seen until build() runs again.
+    void build(Graph& g) {
+        build(g.csr());
+    }
+
+    // Same, for a map opened with RoadMapIO
+    void build(const CSRGraph& csr) {
+        numVertices = csr.getNumVertices();
+        directed = csr.isDirected();
+        numShortcuts = 0;
+        mapArcs = csr.getNumArcs();
+        mapChecksum = checksum(csr);
+
+        Builder b;
+        b.out.assign(numVertices, vector<Arc>());
+        b.in.assign(numVertices, vector<Arc>());
+        b.contractedNeighbours.assign(numVertices, 0);
+        b.level.assign(numVertices, 0);
+        b.touchedBy.assign(numVertices, -1);
+        b.isTarget.assign(numVertices, -1);
+        b.witnessDist.assign(numVertices, 0);
+        b.witnessSeen.assign(numVertices, 0);
+        b.witnessGeneration = 0;
+        b.witnessPq = new IndexedHeap<int>(numVertices);
+
+        for (int u = 0; u < numVertices; u++) {
+            for (int e = csr.arcBegin(u); e < csr.arcEnd(u); e++) {
+                int v = csr.arcDest(e);
+                if (v == u) continue; // Self-loops never shorten a route
+                addArc(b.out[u], v, csr.arcWeight(e), -1);
+                addArc(b.in[v], u, csr.arcWeight(e), -1);
+            }
+        }
+
+        // Pop the cheapest vertex and re-check it, putting it back if it is
+        // no longer the cheapest. Neighbours are re-scored after each step.
+        IndexedHeap<int> order(numVertices);
+        for (int v = 0; v < numVertices; v++) order.insert(v, priority(b, v));
+
+        vector<vector<Arc> > upLists(numVertices), downLists(numVertices);
+        rank.assign(numVertices, 0);
+        int nextRank = 0;
+
+        while (!order.isEmpty()) {
+            int v = order.extractMin();
+            int p = priority(b, v);
+            if (!order.isEmpty() && p > order.minKey()) {
+                order.insert(v, p);
+                continue;
+            }
+
+            numShortcuts += contract(b, v, false);
+            rank[v] = nextRank++;
+
+            // v's remaining arcs all lead to vertices contracted later
+            upLists[v].swap(b.out[v]);
+            downLists[v].swap(b.in[v]);
+            for (size_t i = 0; i < upLists[v].size(); i++) {
+                removeArc(b.in[upLists[v][i].to], v);
+            }
+            for (size_t i = 0; i < downLists[v].size(); i++) {
+                removeArc(b.out[downLists[v][i].to], v);
+            }
+            for (size_t i = 0; i < upLists[v].size(); i++) {
+                touchNeighbour(b, order, upLists[v][i].to, v);
+            }
+            for (size_t i = 0; i < downLists[v].size(); i++) {
+                touchNeighbour(b, order, downLists[v][i].to, v);
+            }
+        }
+        delete b.witnessPq;
+
+        toCSR(upLists, up);
+        toCSR(downLists, down);
+        prepareScratch();
+    }
+
+    bool isBuilt() const {
+        return numVertices > 0;
+    }
+
+    // UNREACHABLE if there is no route
+    int distance(int src, int dest) {
+        RouteResult scratch;
+        return query(src, dest, scratch, false);
+    }
+
+    bool findRoute(int src, int dest, RouteResult& out) {
+        return query(src, dest, out, true) != UNREACHABLE;
+    }
+
+    RouteResult findRoute(int src, int dest) {
+        RouteResult result;
+        findRoute(src, dest, result);
+        return result;
+    }
+
+    // Both upward searches run until neither frontier is below the best
+    // meeting distance. There is no early stop at the destination: the
+    // meeting vertex is usually ranked above both ends.
+    int query(int src, int dest, RouteResult& out, bool wantPath) {
+        out.path.clear();
+        out.distance = UNREACHABLE;
+        if (src < 0 || src >= numVertices || dest < 0 || dest >= numVertices) {
+            Display::printError("Invalid vertex index");
+            return UNREACHABLE;
+        }
+
+        nextGeneration();
+        settledCount = 0;
+
+        fwdDist[src] = 0;
+        fwdParent[src] = -1;
+        fwdSeen[src] = generation;
+        fwdPq->insert(src, 0);
+        bwdDist[dest] = 0;
+        bwdParent[dest] = -1;
+        bwdSeen[dest] = generation;
+        bwdPq->insert(dest, 0);
+
+        int mu = UNREACHABLE;
+        int meet = -1;
+        for (;;) {
+            bool fwdOpen = !fwdPq->isEmpty() && fwdPq->minKey() < mu;
+            bool bwdOpen = !bwdPq->isEmpty() && bwdPq->minKey() < mu;
+            if (!fwdOpen && !bwdOpen) break;
+            bool forward = fwdOpen && (!bwdOpen || fwdPq->minKey() <= bwdPq->minKey());
+            step(forward, mu, meet);
+        }
+
+        out.distance = mu;
+        if (mu == UNREACHABLE || !wantPath) return mu;
+
+        // src .. meet: collect the upward chain, then unpack each arc in order
+        vector<int> chain;
+        for (int v = meet; v != -1; v = fwdParent[v]) chain.push_back(v);
+        out.path.push_back(src);
+        for (int i = (int)chain.size() - 1; i > 0; i--) {
+            unpack(chain[i], chain[i - 1], fwdMid[chain[i - 1]], out.path);
+        }
+        // meet .. dest: bwdParent already points toward dest
+        for (int v = meet; bwdParent[v] != -1; v = bwdParent[v]) {
+            unpack(v, bwdParent[v], bwdMid[v], out.path);
+        }
+        return mu;
+    }
+
+    // Bucket-based many-to-many: out[i * M + j] = distance sources[i] ->
+    // targets[j]. One backward climb per target leaves (j, distance) in a
+    // bucket at every vertex it reaches; one forward climb per source then
+    // reads the buckets of the vertices it reaches. Each pair's shortest
+    // route shows up at its highest vertex, as in a normal query.
+    bool manyToMany(const vector<int>& sources, const vector<int>& targets, vector<int>& out) {
+        int n = (int)sources.size();
+        int m = (int)targets.size();
+        for (int i = 0; i < n; i++) {
+            if (sources[i] < 0 || sources[i] >= numVertices) {
+                Display::printError("Invalid source vertex");
+                return false;
+            }
+        }
+        for (int j = 0; j < m; j++) {
+            if (targets[j] < 0 || targets[j] >= numVertices) {
+                Display::printError("Invalid target vertex");
+                return false;
+            }
+        }
+
+        out.assign((size_t)n * m, UNREACHABLE);
+        if (n == 0 || m == 0) return true;
+        if (bucket.size() != (size_t)numVertices) bucket.assign(numVertices, vector<pair<int, int> >());
+        vector<int> filled;
+
+        for (int j = 0; j < m; j++) {
+            climb(false, targets[j]);
+            for (size_t k = 0; k < climbed.size(); k++) {
+                int v = climbed[k];
+                if (bucket[v].empty()) filled.push_back(v);
+                bucket[v].push_back(make_pair(j, bwdDist[v]));
+            }
+        }
+
+        for (int i = 0; i < n; i++) {
+            climb(true, sources[i]);
+            int* row = &out[(size_t)i * m];
+            for (size_t k = 0; k < climbed.size(); k++) {
+                int u = climbed[k];
+                const vector<pair<int, int> >& entries = bucket[u];
+                for (size_t b = 0; b < entries.size(); b++) {
+                    int total = fwdDist[u] + entries[b].second;
+                    if (total < row[entries[b].first]) row[entries[b].first] = total;
+                }
+            }
+        }
+
+        for (size_t k = 0; k < filled.size(); k++) bucket[filled[k]].clear();
+        return true;
+    }
+
+    // Vertices settled by the last query (both directions)
+    int lastSettledCount() const {
+        return settledCount;
+    }
+
+    int getNumVertices() const {
+        return numVertices;
+    }
+
+    int getNumShortcuts() const {
+        return numShortcuts;
+    }
+
+    // Bytes held by the hierarchy itself (ranks + both upward graphs)
+    size_t memoryBytes() const {
+        size_t ints = rank.size()
+                    + up.offsets.size() + up.dests.size() + up.weights.size() + up.mids.size()
+                    + down.offsets.size() + down.dests.size() + down.weights.size() + down.mids.size();
+        return ints * sizeof(int);
+    }
+
+    // True if this was built (or saved) from exactly this map: same vertex
+    // and arc counts and the same arcs and weights
+    bool matches(const CSRGraph& csr) const {
+        return isBuilt() && numVertices == csr.getNumVertices() && mapArcs == csr.getNumArcs()
+            && mapChecksum == checksum(csr);
+    }
+
+    bool matches(Graph& g) {
+        return matches(g.csr());
+    }
+
+    // Binary layout: "CH02", vertex count, directed flag, shortcut count,
+    // the map's arc count and checksum, then rank and the two upward graphs
+    // as length-prefixed int arrays (native byte order)
+    bool save(const string& path) const {
+        ofstream file(path.c_str(), ios::binary);
+        if (!file) {
+            Display::printError("Cannot write " + path);
+            return false;
+        }
+        file.write("CH02", 4);
+        int flag = directed ? 1 : 0;
+        file.write((const char*)&numVertices, sizeof(numVertices));
+        file.write((const char*)&flag, sizeof(flag));
+        file.write((const char*)&numShortcuts, sizeof(numShortcuts));
+        file.write((const char*)&mapArcs, sizeof(mapArcs));
+        file.write((const char*)&mapChecksum, sizeof(mapChecksum));
+        writeVector(file, rank);
+        writeVector(file, up.offsets);
+        writeVector(file, up.dests);
+        writeVector(file, up.weights);
+        writeVector(file, up.mids);
+        writeVector(file, down.offsets);
+        writeVector(file, down.dests);
+        writeVector(file, down.weights);
+        writeVector(file, down.mids);
+        return (bool)file;
+    }
+
+    bool load(const string& path) {
+        ifstream file(path.c_str(), ios::binary);
+        char magic[4];
+        int flag = 0;
+        int n = 0;
+        int shortcuts = 0;
+        int arcs = 0;
+        unsigned long long sum = 0;
+        if (!file || !file.read(magic, 4) || string(magic, 4) != "CH02"
+            || !file.read((char*)&n, sizeof(n)) || !file.read((char*)&flag, sizeof(flag))
+            || !file.read((char*)&shortcuts, sizeof(shortcuts))
+            || !file.read((char*)&arcs, sizeof(arcs)) || !file.read((char*)&sum, sizeof(sum))) {
+            Display::printError("Not a contraction hierarchy file: " + path);
+            return false;
+        }
+        long long headerEnd = (long long)file.tellg();
+        file.seekg(0, ios::end);
+        long long bytesLeft = (long long)file.tellg() - headerEnd;
+        file.seekg(headerEnd);
+
+        UpwardGraph newUp, newDown;
+        vector<int> newRank;
+        bool ok = n > 0 && arcs >= 0
+               && readVector(file, newRank, bytesLeft)
+               && readVector(file, newUp.offsets, bytesLeft) && readVector(file, newUp.dests, bytesLeft)
+               && readVector(file, newUp.weights, bytesLeft) && readVector(file, newUp.mids, bytesLeft)
+               && readVector(file, newDown.offsets, bytesLeft) && readVector(file, newDown.dests, bytesLeft)
+               && readVector(file, newDown.weights, bytesLeft) && readVector(file, newDown.mids, bytesLeft)
+               && bytesLeft == 0 && (int)newRank.size() == n;
+        if (ok) {
+            // rank must be a permutation of 0 .. n-1
+            vector<char> used(n, 0);
+            for (int v = 0; ok && v < n; v++) {
+                int r = newRank[v];
+                ok = r >= 0 && r < n && !used[r];
+                if (ok) used[r] = 1;
+            }
+        }
+        ok = ok && validUpward(newUp, newRank, n) && validUpward(newDown, newRank, n);
+        if (!ok) {
+            Display::printError("Corrupt contraction hierarchy file: " + path);
+            return false;
+        }
+
+        numVertices = n;
+        directed = flag != 0;
+        numShortcuts = shortcuts;
+        mapArcs = arcs;
+        mapChecksum = sum;
+        rank.swap(newRank);
+        up.offsets.swap(newUp.offsets);
+        up.dests.swap(newUp.dests);
+        up.weights.swap(newUp.weights);
+        up.mids.swap(newUp.mids);
+        down.offsets.swap(newDown.offsets);
+        down.dests.swap(newDown.dests);
+        down.weights.swap(newDown.weights);
+        down.mids.swap(newDown.mids);
+        prepareScratch();
+        return true;
+    }
+};
+
+#endif
@@ -1,43 +1,67 @@
-#ifndef CUSTOMERMANAGER_H
-#define CUSTOMERMANAGER_H
-
-#include "Customer.h"
-#include "LinkedList.h"
-#include "Display.h"
-#include <string>
-
-using namespace std;
-
-// Using LinkedList instead of HashTable for simpler implementation
-class CustomerManager {
-private:
-    LinkedList<Customer> customers;
-
-public:
-    void registerCustomer(string id, string name, string phone, string address) {
-        Display::printSystemLog("LinkedList: Adding customer at tail");
-        Customer newCustomer(id, name, phone, address);
-        customers.insertTail(newCustomer);
-        Display::printSuccess("Customer Registered: " + name);
-    }
-
-    Customer* login(string phone) {
-        Display::printSystemLog("LinkedList: Searching for phone " + phone);
-        Node<Customer>* temp = customers.getHead();
-        while (temp) {
-            if (temp->data.phone == phone) {
-                Display::printSuccess("Customer found!");
-                return new Customer(temp->data);
-            }
-            temp = temp->next;
-        }
-        return nullptr;
-    }
-
-    void displayAll() {
-        Display::printHeader("All Customers");
-        customers.display();
-    }
-};
-
-#endif
+#ifndef CUSTOMERMANAGER_H
+#define CUSTOMERMANAGER_H
+
+#include "Customer.h"
+#include "LinkedList.h"
+#include "HashTable.h"
+#include "Display.h"
+#include <string>
+
+using namespace std;
+
+// Customers live in a LinkedList (node addresses never move), and two hash
+// indexes map phone and ID to the stored Customer for O(1) login/lookup.
+class CustomerManager {
+private:
+    LinkedList<Customer> customers;
+    HashTable<string, Customer*> byPhone;
+    HashTable<string, Customer*> byId;
+
+public:
+    // Pre-size the indexes for bulk loads
+    void reserve(int n) {
+        byPhone.reserve(n);
+        byId.reserve(n);
+    }
+
+    bool registerCustomer(string id, string name, string phone, string address) {
+        if (byId.contains(id) || byPhone.contains(phone)) {
+            Display::printError("Customer ID or phone already registered");
+            return false;
+        }
+        DISPLAY_SYSTEM_LOG("LinkedList: Adding customer at tail");
+        Customer& c = customers.emplaceTail(std::move(id), std::move(name), std::move(phone), std::move(address));
+        DISPLAY_SYSTEM_LOG("HashTable: Indexing customer by phone and ID");
+        byPhone.insert(c.phone, &c);
+        byId.insert(c.id, &c);
+        Display::printSuccess("Customer Registered: " + c.name);
+        return true;
+    }
+
+    // Returns the stored customer (owned by the manager), or nullptr
+    Customer* login(const string& phone) {
+        DISPLAY_SYSTEM_LOG("HashTable: Looking up phone " + phone);
+        Customer** found = byPhone.find(phone);
+        if (found) {
+            Display::printSuccess("Customer found!");
+            return *found;
+        }
+        return nullptr;
+    }
+
+    Customer* findById(const string& id) {
+        Customer** found = byId.find(id);
+        return found ? *found : nullptr;
+    }
+
+    int size() const {
+        return customers.size();
+    }
+
+    void displayAll() {
+        Display::printHeader("All Customers");
+        customers.display();
+    }
+};
+
+#endif
@@ -1,42 +1,223 @@
-#ifndef DELIVERYAGENT_H
-#define DELIVERYAGENT_H
-
-#include <string>
-#include "Order.h"
-
-using namespace std;
-
-class DeliveryAgent {
-public:
-    string id;
-    string name;
-    string phone;
-    bool isAvailable;
-    Order currentOrder;
-
-    DeliveryAgent(string id, string name, string phone)
-        : id(id), name(name), phone(phone), isAvailable(true) {}
-
-    DeliveryAgent() : id(""), name(""), phone(""), isAvailable(true) {}
-
-    void assignOrder(Order order) {
-        currentOrder = order;
-        isAvailable = false;
-    }
-
-    void completeDelivery() {
-        isAvailable = true;
-        currentOrder = Order(); // Reset
-    }
-
-    bool operator==(const DeliveryAgent& other) const {
-        return id == other.id;
-    }
-
-    friend ostream& operator<<(ostream& os, const DeliveryAgent& da) {
-        os << "[" << da.id << "] " << da.name << " (" << (da.isAvailable ? "Available" : "Busy") << ")";
-        return os;
-    }
-};
-
-#endif
+#ifndef DELIVERYAGENT_H
+#define DELIVERYAGENT_H
+
+#include <string>
+#include <vector>
+#include "Order.h"
+
+using namespace std;
+
+class DeliveryAgent;
+
+// One pickup or drop-off on an agent's multi-stop route
+struct RouteStop {
+    int sector;
+    bool pickup;
+    string orderID;
+};
+
+// Free agents of one DeliveryManager, longest idle first. The list is
+// intrusive: agents carry their own links and move themselves in and out
+// in assignOrder()/completeDelivery(), so no search is ever needed.
+struct FreeAgentPool {
+    DeliveryAgent* head;
+    DeliveryAgent* tail;
+    int count;
+
+    FreeAgentPool() : head(nullptr), tail(nullptr), count(0) {}
+};
+
+class DeliveryAgent {
+private:
+    FreeAgentPool* pool;
+    DeliveryAgent* prevFree;
+    DeliveryAgent* nextFree;
+    bool inPool;
+
+    bool available;
+    Order currentOrder;
+
+    // Where the agent is now (km on the sector grid); sector is -1 and
+    // positioned false until the agent has been placed somewhere
+    int sector;
+    double x, y;
+    bool positioned;
+
+    // Multi-stop work: orders on the route and the stops still to visit
+    vector<Order> routeOrders;
+    vector<RouteStop> route;
+
+    // Owned by AgentGrid: cell and slot while indexed as free, slot -1 otherwise
+    long long gridCell;
+    int gridSlot;
+
+    void linkFree() {
+        if (!pool || inPool) return;
+        prevFree = pool->tail;
+        nextFree = nullptr;
+        if (pool->tail) pool->tail->nextFree = this;
+        else pool->head = this;
+        pool->tail = this;
+        pool->count++;
+        inPool = true;
+    }
+
+    void unlinkFree() {
+        if (!pool || !inPool) return;
+        if (prevFree) prevFree->nextFree = nextFree;
+        else pool->head = nextFree;
+        if (nextFree) nextFree->prevFree = prevFree;
+        else pool->tail = prevFree;
+        prevFree = nextFree = nullptr;
+        pool->count--;
+        inPool = false;
+    }
+
+    // State changes go through DeliveryManager, which keeps its AgentGrid
+    // in step with them (a free agent must be indexed where it stands);
+    // the grid itself only reads the position and keeps its cell and slot
+    friend class DeliveryManager;
+    friend class AgentGrid;
+
+    void moveTo(int newSector, double newX, double newY) {
+        sector = newSector;
+        x = newX;
+        y = newY;
+        positioned = true;
+    }
+
+    // Somewhere in newSector; the old coordinates no longer apply
+    void moveTo(int newSector) {
+        sector = newSector;
+        positioned = false;
+    }
+
+    void assignOrder(Order order) {
+        currentOrder = std::move(order);
+        available = false;
+        unlinkFree();
+    }
+
+    // Refused while route stops (and the orders they carry) remain
+    bool completeDelivery() {
+        if (onRoute()) return false;
+        available = true;
+        currentOrder = Order(); // Reset
+        routeOrders.clear();
+        route.clear();
+        linkFree();
+        return true;
+    }
+
+    // Replace the stops still to visit; orders join those already carried
+    void assignRoute(vector<Order> orders, vector<RouteStop> stops) {
+        for (size_t i = 0; i < orders.size(); i++) {
+            routeOrders.push_back(std::move(orders[i]));
+        }
+        route = std::move(stops);
+        available = false;
+        unlinkFree();
+    }
+
+    // Arrive at the next stop; a drop-off finishes that order and the last
+    // stop frees the agent. False if there is no route.
+    bool visitNextStop() {
+        if (route.empty()) return false;
+        RouteStop stop = route.front();
+        route.erase(route.begin());
+        sector = stop.sector;
+        if (!stop.pickup) {
+            for (size_t i = 0; i < routeOrders.size(); i++) {
+                if (routeOrders[i].orderID == stop.orderID) {
+                    routeOrders.erase(routeOrders.begin() + i);
+                    break;
+                }
+            }
+        }
+        if (route.empty()) completeDelivery();
+        return true;
+    }
+
+public:
+    string id;
+    string name;
+    string phone;
+
+    DeliveryAgent(string id, string name, string phone)
+        : pool(nullptr), prevFree(nullptr), nextFree(nullptr), inPool(false), available(true),
+          sector(-1), x(0), y(0), positioned(false), gridCell(0), gridSlot(-1),
+          id(std::move(id)), name(std::move(name)), phone(std::move(phone)) {}
+
+    DeliveryAgent() : pool(nullptr), prevFree(nullptr), nextFree(nullptr), inPool(false), available(true),
+          sector(-1), x(0), y(0), positioned(false), gridCell(0), gridSlot(-1),
+          id(""), name(""), phone("") {}
+
+    ~DeliveryAgent() {
+        unlinkFree();
+    }
+
+    // Other agents point at this one through the pool links
+    DeliveryAgent(const DeliveryAgent&) = delete;
+    DeliveryAgent& operator=(const DeliveryAgent&) = delete;
+
+    // Join p (nullptr to leave); listed in it whenever available
+    void setPool(FreeAgentPool* p) {
+        unlinkFree();
+        pool = p;
+        if (available) linkFree();
+    }
+
+    // Next free agent in the same pool, nullptr at the end
+    DeliveryAgent* nextAvailable() const {
+        return nextFree;
+    }
+
+    bool isAvailable() const {
+        return available;
+    }
+
+    const Order& getCurrentOrder() const {
+        return currentOrder;
+    }
+
+    int getSector() const {
+        return sector;
+    }
+
+    double getX() const {
+        return x;
+    }
+
+    double getY() const {
+        return y;
+    }
+
+    bool hasPosition() const {
+        return positioned;
+    }
+
+    // Orders on the route, and the stops still to visit in order
+    const vector<Order>& getRouteOrders() const {
+        return routeOrders;
+    }
+
+    const vector<RouteStop>& getRoute() const {
+        return route;
+    }
+
+    bool onRoute() const {
+        return !route.empty();
+    }
+
+    bool operator==(const DeliveryAgent& other) const {
+        return id == other.id;
+    }
+
+    friend ostream& operator<<(ostream& os, const DeliveryAgent& da) {
+        os << "[" << da.id << "] " << da.name << " (" << (da.available ? "Available" : "Busy") << ")";
+        if (!da.route.empty()) os << " " << da.route.size() << " stops left";
+        return os;
+    }
+};
+
+#endif
@@ -1,50 +1,219 @@
-#ifndef DELIVERYMANAGER_H
-#define DELIVERYMANAGER_H
-
-#include "DeliveryAgent.h"
-#include "LinkedList.h"
-#include "Display.h"
-
-using namespace std;
-
-class DeliveryManager {
-private:
-    LinkedList<DeliveryAgent> agents;
-
-public:
-    void addAgent(string id, string name, string phone) {
-        DeliveryAgent da(id, name, phone);
-        agents.insertTail(da);
-        Display::printSuccess("Agent Added: " + name);
-    }
-
-    DeliveryAgent* getAvailableAgent() {
-        Display::printSystemLog("Searching LinkedList for available agent...");
-        Node<DeliveryAgent>* temp = agents.getHead();
-        while (temp) {
-            if (temp->data.isAvailable) {
-                Display::printSystemLog("Available agent found.");
-                return &(temp->data);
-            }
-            temp = temp->next;
-        }
-        return nullptr;
-    }
-
-    void assignAgent(Order order) {
-        DeliveryAgent* agent = getAvailableAgent();
-        if (agent) {
-            agent->assignOrder(order);
-            Display::printSuccess("Order assigned to agent: " + agent->name);
-        } else {
-            Display::printError("No delivery agents available!");
-        }
-    }
-
-    void displayAgents() {
-        Display::printHeader("Delivery Agents");
-        agents.display();
-    }
-};
-
-#endif
+#ifndef DELIVERYMANAGER_H
+#define DELIVERYMANAGER_H
+
+#include "DeliveryAgent.h"
+#include "AgentGrid.h"
+#include "HashTable.h"
+#include "LinkedList.h"
+#include "Display.h"
+
+using namespace std;
+
+// Agents live in the LinkedList (stable addresses); byId finds one by ID.
+// available lists every free agent (the agents keep it up to date
+// themselves), and freeAgents holds the free ones whose position is known,
+// so the closest one to a restaurant is found without walking the whole list.
+
+class DeliveryManager {
+private:
+    FreeAgentPool available;   // Declared first: agents unlink on destruction
+    LinkedList<DeliveryAgent> agents;
+    HashTable<string, DeliveryAgent*> byId;
+    AgentGrid freeAgents;
+
+    // Closest placed free agent by walking the whole free list
+    DeliveryAgent* scanNearest(double x, double y) {
+        DeliveryAgent* best = nullptr;
+        double bestSq = 0;
+        for (DeliveryAgent* a = available.head; a; a = a->nextAvailable()) {
+            if (!freeAgents.contains(a)) continue;
+            double dx = a->getX() - x;
+            double dy = a->getY() - y;
+            double d = dx * dx + dy * dy;
+            if (!best || d < bestSq) {
+                best = a;
+                bestSq = d;
+            }
+        }
+        return best;
+    }
+
+    DeliveryAgent* dispatch(DeliveryAgent* agent, Order order) {
+        freeAgents.remove(agent);
+        agent->assignOrder(std::move(order));
+        Display::printSuccess("Order assigned to agent: " + agent->name);
+        return agent;
+    }
+
+public:
+    // gridCellSize is in the units of agent positions: about one
+    // neighbourhood wide, 2 for the km sector grid
+    explicit DeliveryManager(double gridCellSize = 2.0) : freeAgents(gridCellSize) {}
+
+    bool addAgent(string id, string name, string phone) {
+        if (byId.contains(id)) {
+            Display::printError("Agent ID already exists: " + id);
+            return false;
+        }
+        DeliveryAgent& da = agents.emplaceTail(std::move(id), std::move(name), std::move(phone));
+        byId.insert(da.id, &da);
+        da.setPool(&available);
+        Display::printSuccess("Agent Added: " + da.name);
+        return true;
+    }
+
+    // Agent starting out at (x, y) in the given sector
+    bool addAgent(string id, string name, string phone, int sector, double x, double y) {
+        string key = id;
+        if (!addAgent(std::move(id), std::move(name), std::move(phone))) return false;
+        DeliveryAgent* da = getAgent(key);
+        da->moveTo(sector, x, y);
+        freeAgents.insert(da);
+        return true;
+    }
+
+    // Agent is now at (x, y); a free agent is re-indexed there
+    void moveAgent(DeliveryAgent* agent, int sector, double x, double y) {
+        freeAgents.remove(agent);
+        agent->moveTo(sector, x, y);
+        if (agent->isAvailable()) freeAgents.insert(agent);
+    }
+
+    // Agent is now in sector, exact position unknown; they leave the grid
+    // until moved to a position again
+    void moveAgent(DeliveryAgent* agent, int sector) {
+        freeAgents.remove(agent);
+        agent->moveTo(sector);
+    }
+
+    DeliveryAgent* getAgent(const string& id) {
+        DeliveryAgent** found = byId.find(id);
+        return found ? *found : nullptr;
+    }
+
+    // Longest-idle free agent, O(1)
+    DeliveryAgent* getAvailableAgent() {
+        DISPLAY_SYSTEM_LOG("Taking first agent from the free-agent list...");
+        return available.head;
+    }
+
+    int countAvailable() const {
+        return available.count;
+    }
+
+    // Closest free agent to (x, y); falls back to any free agent when none
+    // of the free ones has a known position
+    DeliveryAgent* getNearestAgent(double x, double y) {
+        DISPLAY_SYSTEM_LOG("Searching agent grid around pickup point...");
+        bool gaveUp;
+        DeliveryAgent* agent = freeAgents.nearest(x, y, gaveUp);
+        if (gaveUp) {
+            DISPLAY_SYSTEM_LOG("Grid cells too small for this map, scanning free list...");
+            agent = scanNearest(x, y);
+        }
+        if (agent && agent->isAvailable()) return agent;
+        return getAvailableAgent();
+    }
+
+    DeliveryAgent* assignAgent(Order order) {
+        DeliveryAgent* agent = getAvailableAgent();
+        if (!agent) {
+            Display::printError("No delivery agents available!");
+            return nullptr;
+        }
+        return dispatch(agent, std::move(order));
+    }
+
+    // Assign the free agent closest to the pickup point (x, y)
+    DeliveryAgent* assignAgent(Order order, double x, double y) {
+        DeliveryAgent* agent = getNearestAgent(x, y);
+        if (!agent) {
+            Display::printError("No delivery agents available!");
+            return nullptr;
+        }
+        return dispatch(agent, std::move(order));
+    }
+
+    // Assign to this particular agent (e.g. chosen by a BatchDispatcher)
+    bool assignTo(DeliveryAgent* agent, Order order) {
+        if (!agent || !agent->isAvailable()) {
+            Display::printError("Agent is not available");
+            return false;
+        }
+        dispatch(agent, std::move(order));
+        return true;
+    }
+
+    // Give agent a multi-stop route; free agents and agents already on a
+    // route (whose remaining stops it replaces) can take one
+    bool assignRoute(DeliveryAgent* agent, vector<Order> orders, vector<RouteStop> stops) {
+        if (!agent || stops.empty() || (!agent->isAvailable() && !agent->onRoute())) {
+            Display::printError("Agent cannot take a route");
+            return false;
+        }
+        freeAgents.remove(agent);
+        agent->assignRoute(std::move(orders), std::move(stops));
+        Display::printSuccess("Route of " + to_string(agent->getRoute().size()) + " stops assigned to agent: " + agent->name);
+        return true;
+    }
+
+    // Agent reached the next stop on their route, at (x, y)
+    bool arriveAtStop(const string& agentId, double x, double y) {
+        DeliveryAgent* agent = getAgent(agentId);
+        if (!agent || !agent->onRoute()) {
+            Display::printError("No route for agent: " + agentId);
+            return false;
+        }
+        agent->visitNextStop();
+        agent->moveTo(agent->getSector(), x, y);
+        if (agent->isAvailable()) freeAgents.insert(agent);
+        return true;
+    }
+
+    // Agents currently driving a multi-stop route
+    vector<DeliveryAgent*> getRoutedAgents() {
+        vector<DeliveryAgent*> out;
+        for (Node<DeliveryAgent>* temp = agents.getHead(); temp; temp = temp->next) {
+            if (temp->data.onRoute()) out.push_back(&temp->data);
+        }
+        return out;
+    }
+
+    // Agent is free again where they are. An agent on a route finishes it
+    // stop by stop with arriveAtStop(); dropping the route here would lose
+    // the orders still on board.
+    bool completeDelivery(const string& agentId) {
+        DeliveryAgent* agent = getAgent(agentId);
+        if (!agent || agent->isAvailable()) {
+            Display::printError("No active delivery for agent: " + agentId);
+            return false;
+        }
+        if (!agent->completeDelivery()) {
+            Display::printError("Agent " + agentId + " still has " + to_string(agent->getRoute().size())
+                                + " stops on their route");
+            return false;
+        }
+        if (agent->hasPosition()) freeAgents.insert(agent);
+        return true;
+    }
+
+    // Agent is free again at the drop-off point
+    bool completeDelivery(const string& agentId, int sector, double x, double y) {
+        DeliveryAgent* agent = getAgent(agentId);
+        if (!agent || agent->isAvailable() || agent->onRoute()) return completeDelivery(agentId);
+        agent->moveTo(sector, x, y);
+        return completeDelivery(agentId);
+    }
+
+    int countAgents() const {
+        return agents.size();
+    }
+
+    void displayAgents() {
+        Display::printHeader("Delivery Agents");
+        agents.display();
+        cout << " Available: " << available.count << " of " << agents.size() << "\n";
+    }
+};
+
+#endif
@@ -0,0 +1,178 @@
+#ifndef DISJOINTSET_H
+#define DISJOINTSET_H
+
+#include <atomic>
+
+using namespace std;
+
+// ============================================================================
+// DISJOINT SET (Union-Find) - Which group is each element in?
+// ============================================================================
+// Used by Kruskal's and Boruvka's MST (is this road between two different
+// trees yet?) and for grouping sectors into delivery zones.
+//
+// find() walks to the root iteratively with path halving: every visited
+// element is re-pointed at its grandparent, which flattens the tree about
+// as well as full path compression but needs no recursion and only one
+// pass. unite() hangs the smaller set under the larger one (union by
+// size), so trees stay O(log n) deep even before halving kicks in.
+
+class DisjointSet {
+private:
+    int numElements;
+    int numSets;
+    int* parent;
+    int* size;    // Only meaningful at roots
+
+public:
+    explicit DisjointSet(int n) : numElements(n), numSets(n) {
+        parent = new int[n > 0 ? n : 1];
+        size = new int[n > 0 ? n : 1];
+        reset();
+    }
+
+    ~DisjointSet() {
+        delete[] parent;
+        delete[] size;
+    }
+
+    DisjointSet(const DisjointSet&) = delete;
+    DisjointSet& operator=(const DisjointSet&) = delete;
+
+    // Every element back in its own set
+    void reset() {
+        for (int i = 0; i < numElements; i++) {
+            parent[i] = i;
+            size[i] = 1;
+        }
+        numSets = numElements;
+    }
+
+    int find(int x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+
+    // Merge the sets of x and y; false if they were already one set
+    bool unite(int x, int y) {
+        x = find(x);
+        y = find(y);
+        if (x == y) return false;
+        if (size[x] < size[y]) {
+            int t = x;
+            x = y;
+            y = t;
+        }
+        parent[y] = x;
+        size[x] += size[y];
+        numSets--;
+        return true;
+    }
+
+    bool connected(int x, int y) {
+        return find(x) == find(y);
+    }
+
+    // Number of elements in x's set
+    int setSize(int x) {
+        return size[find(x)];
+    }
+
+    int countSets() const {
+        return numSets;
+    }
+
+    int getNumElements() const {
+        return numElements;
+    }
+};
+
+// ============================================================================
+// CONCURRENT DISJOINT SET - Same operations, callable from many threads
+// ============================================================================
+// Lock-free: parent links are atomics and a root is linked with one
+// compare-and-swap, which fails (and the caller retries) if another thread
+// linked that root first. Sizes cannot be kept in step with the parent
+// without a double-width CAS, so the winner of a link is decided by a fixed
+// random-looking priority per element instead (randomized linking), which
+// keeps the expected depth O(log n). Priorities are distinct and links
+// always go to the higher one, so no interleaving can create a cycle.
+// reset() and the constructor are not thread-safe.
+
+class ConcurrentDisjointSet {
+private:
+    int numElements;
+    atomic<int>* parent;
+
+    // x * odd constant is a bijection on 32 bits: distinct, well mixed
+    static unsigned int priority(int x) {
+        return (unsigned int)x * 2654435761u;
+    }
+
+public:
+    explicit ConcurrentDisjointSet(int n) : numElements(n) {
+        parent = new atomic<int>[n > 0 ? n : 1];
+        reset();
+    }
+
+    ~ConcurrentDisjointSet() {
+        delete[] parent;
+    }
+
+    ConcurrentDisjointSet(const ConcurrentDisjointSet&) = delete;
+    ConcurrentDisjointSet& operator=(const ConcurrentDisjointSet&) = delete;
+
+    void reset() {
+        for (int i = 0; i < numElements; i++) {
+            parent[i].store(i, memory_order_relaxed);
+        }
+    }
+
+    // Path halving; a lost halving step (another thread changed the entry
+    // first) only skips a shortcut, it never breaks a path
+    int find(int x) {
+        for (;;) {
+            int p = parent[x].load(memory_order_relaxed);
+            if (p == x) return x;
+            int gp = parent[p].load(memory_order_relaxed);
+            if (gp != p) parent[x].compare_exchange_weak(p, gp, memory_order_relaxed);
+            x = gp;
+        }
+    }
+
+    // True if x and y were in different sets and this call merged them
+    bool unite(int x, int y) {
+        for (;;) {
+            x = find(x);
+            y = find(y);
+            if (x == y) return false;
+            if (priority(x) > priority(y)) {
+                int t = x;
+                x = y;
+                y = t;
+            }
+            int expected = x;
+            if (parent[x].compare_exchange_strong(expected, y)) return true;
+            // x stopped being a root meanwhile; look again
+        }
+    }
+
+    // Exact even while other threads unite: x's root is re-checked
+    bool connected(int x, int y) {
+        for (;;) {
+            x = find(x);
+            y = find(y);
+            if (x == y) return true;
+            if (parent[x].load() == x) return false;
+        }
+    }
+
+    int getNumElements() const {
+        return numElements;
+    }
+};
+
+#endif
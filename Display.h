@@ -1,109 +1,271 @@
-#ifndef DISPLAY_H
-#define DISPLAY_H
-
-#include <iostream>
-#include <string>
-#ifndef NOMINMAX
-#define NOMINMAX
-#endif
-#include <windows.h>
-
-using namespace std;
-
-class Display {
-public:
-    // Color constants
-    static const int BLACK = 0;
-    static const int BLUE = 1;
-    static const int GREEN = 2;
-    static const int CYAN = 3;
-    static const int RED = 4;
-    static const int MAGENTA = 5;
-    static const int YELLOW = 6;
-    static const int WHITE = 7;
-    static const int GRAY = 8;
-    static const int LIGHT_BLUE = 9;
-    static const int LIGHT_GREEN = 10;
-    static const int LIGHT_CYAN = 11;
-    static const int LIGHT_RED = 12;
-    static const int LIGHT_MAGENTA = 13;
-    static const int LIGHT_YELLOW = 14;
-    static const int BRIGHT_WHITE = 15;
-
-    static void setColor(int textColor, int bgColor = BLACK) {
-        SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), (bgColor << 4) | textColor);
-    }
-
-    static void resetColor() {
-        SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), WHITE);
-    }
-
-    static void clearScreen() {
-        system("cls");
-    }
-
-    static void printHeader(const string& title) {
-        setColor(BRIGHT_WHITE, BLUE);
-        cout << "\n " << title << " \n";
-        resetColor();
-        cout << "\n";
-    }
-
-    static void printMenuOption(int option, const string& text) {
-        setColor(LIGHT_CYAN);
-        cout << " [" << option << "] ";
-        resetColor();
-        cout << text << "\n";
-    }
-
-    static void printError(const string& message) {
-        setColor(LIGHT_RED);
-        cout << " [ERROR] " << message << "\n";
-        resetColor();
-        Beep(500, 200); // Sound alert
-    }
-
-    static void printSuccess(const string& message) {
-        setColor(LIGHT_GREEN);
-        cout << " [SUCCESS] " << message << "\n";
-        resetColor();
-    }
-
-    static void printLine() {
-        setColor(GRAY);
-        cout << "========================================\n";
-        resetColor();
-    }
-
-    static void printSystemLog(const string& message) {
-        setColor(YELLOW);
-        cout << " [SYSTEM] " << message << "\n";
-        resetColor();
-        Sleep(300); // Simulate processing time
-    }
-
-    static void loadingAnimation(const string& message) {
-        setColor(LIGHT_MAGENTA);
-        cout << " " << message;
-        for (int i = 0; i < 3; i++) {
-            cout << ".";
-            Sleep(300);
-        }
-        cout << "\n";
-        resetColor();
-    }
-
-    static void printAsciiArt() {
-        setColor(LIGHT_CYAN);
-        cout << R"(
-   ___              _   ___      _ _                 
-  | __|__  ___   __| | |   \ ___| (_)_ _____ _ _ _  
-  | _/ _ \/ _ \ / _` | | |) / -_) | \ V / -_) '_| | 
-  |_|\___/\___/ \__,_| |___/\___|_|_|\_/\___|_| |_| 
-                                                    
-        )" << "\n";
-        resetColor();
-    }
-};
-
-#endif
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+using namespace std;
+
+// ============================================================================
+// DISPLAY BACKENDS
+// ============================================================================
+// Display forwards every terminal side effect (colors, clearing, beeps and
+// the demo delays) to a DisplaySink so the managers can run on Windows
+// consoles, ANSI/POSIX terminals, or with no output at all.
+//
+// Build flags:
+//   DISPLAY_NO_DEMO - printSystemLog() and loadingAnimation() compile to
+//                     nothing (no text, no delays). Use for benchmarks and
+//                     service builds that drive the managers directly.
+
+class DisplaySink {
+public:
+    virtual ~DisplaySink() {}
+
+    virtual void setColor(int textColor, int bgColor) = 0;
+    virtual void resetColor() = 0;
+    virtual void clearScreen() = 0;
+    virtual void beep() = 0;
+    virtual void pause(int ms) = 0;
+
+    // False for sinks that swallow all Display output
+    virtual bool printsText() const { return true; }
+};
+
+#ifdef _WIN32
+// Original Win32 console behaviour
+class WinConsoleSink : public DisplaySink {
+public:
+    void setColor(int textColor, int bgColor) override {
+        SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), (bgColor << 4) | textColor);
+    }
+
+    void resetColor() override {
+        SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), 7);
+    }
+
+    void clearScreen() override {
+        system("cls");
+    }
+
+    void beep() override {
+        Beep(500, 200);
+    }
+
+    void pause(int ms) override {
+        Sleep(ms);
+    }
+};
+#endif
+
+// ANSI escape sequences - Linux/macOS terminals and modern Windows terminals
+class AnsiSink : public DisplaySink {
+private:
+    // Console colors use bit 0 = blue, bit 2 = red; ANSI has them swapped
+    static int toAnsi(int color) {
+        return ((color & 1) ? 4 : 0) | (color & 2) | ((color & 4) ? 1 : 0);
+    }
+
+public:
+    void setColor(int textColor, int bgColor) override {
+        int fg = ((textColor & 8) ? 90 : 30) + toAnsi(textColor);
+        if (bgColor == 0) {
+            // Keep the terminal's own background
+            cout << "\033[0;" << fg << "m";
+            return;
+        }
+        int bg = ((bgColor & 8) ? 100 : 40) + toAnsi(bgColor);
+        cout << "\033[" << fg << ";" << bg << "m";
+    }
+
+    void resetColor() override {
+        cout << "\033[0m";
+    }
+
+    void clearScreen() override {
+        cout << "\033[2J\033[H" << flush;
+    }
+
+    void beep() override {
+        cout << '\a';
+    }
+
+    void pause(int ms) override {
+        cout << flush;
+        this_thread::sleep_for(chrono::milliseconds(ms));
+    }
+};
+
+// Swallows all Display output - for headless drivers and benchmarks
+class NullSink : public DisplaySink {
+public:
+    void setColor(int, int) override {}
+    void resetColor() override {}
+    void clearScreen() override {}
+    void beep() override {}
+    void pause(int) override {}
+    bool printsText() const override { return false; }
+};
+
+class Display {
+private:
+    static DisplaySink*& currentSink() {
+#ifdef _WIN32
+        static WinConsoleSink defaultSink;
+#else
+        static AnsiSink defaultSink;
+#endif
+        static DisplaySink* sink = &defaultSink;
+        return sink;
+    }
+
+public:
+    // Color constants
+    static const int BLACK = 0;
+    static const int BLUE = 1;
+    static const int GREEN = 2;
+    static const int CYAN = 3;
+    static const int RED = 4;
+    static const int MAGENTA = 5;
+    static const int YELLOW = 6;
+    static const int WHITE = 7;
+    static const int GRAY = 8;
+    static const int LIGHT_BLUE = 9;
+    static const int LIGHT_GREEN = 10;
+    static const int LIGHT_CYAN = 11;
+    static const int LIGHT_RED = 12;
+    static const int LIGHT_MAGENTA = 13;
+    static const int LIGHT_YELLOW = 14;
+    static const int BRIGHT_WHITE = 15;
+
+    // Replace the active backend (caller keeps ownership of the sink)
+    static void setSink(DisplaySink* sink) {
+        currentSink() = sink;
+    }
+
+    static DisplaySink& sink() {
+        return *currentSink();
+    }
+
+    static void useNullBackend() {
+        static NullSink nullSink;
+        setSink(&nullSink);
+    }
+
+    static void useAnsiBackend() {
+        static AnsiSink ansiSink;
+        setSink(&ansiSink);
+    }
+
+    static bool enabled() {
+        return sink().printsText();
+    }
+
+    static void setColor(int textColor, int bgColor = BLACK) {
+        sink().setColor(textColor, bgColor);
+    }
+
+    static void resetColor() {
+        sink().resetColor();
+    }
+
+    static void clearScreen() {
+        sink().clearScreen();
+    }
+
+    static void printHeader(const string& title) {
+        if (!enabled()) return;
+        setColor(BRIGHT_WHITE, BLUE);
+        cout << "\n " << title << " \n";
+        resetColor();
+        cout << "\n";
+    }
+
+    static void printMenuOption(int option, const string& text) {
+        if (!enabled()) return;
+        setColor(LIGHT_CYAN);
+        cout << " [" << option << "] ";
+        resetColor();
+        cout << text << "\n";
+    }
+
+    static void printError(const string& message) {
+        if (!enabled()) return;
+        setColor(LIGHT_RED);
+        cout << " [ERROR] " << message << "\n";
+        resetColor();
+        sink().beep(); // Sound alert
+    }
+
+    static void printSuccess(const string& message) {
+        if (!enabled()) return;
+        setColor(LIGHT_GREEN);
+        cout << " [SUCCESS] " << message << "\n";
+        resetColor();
+    }
+
+    static void printLine() {
+        if (!enabled()) return;
+        setColor(GRAY);
+        cout << "========================================\n";
+        resetColor();
+    }
+
+#ifdef DISPLAY_NO_DEMO
+    static void printSystemLog(const string&) {}
+
+    static void loadingAnimation(const string&) {}
+#else
+    static void printSystemLog(const string& message) {
+        if (!enabled()) return;
+        setColor(YELLOW);
+        cout << " [SYSTEM] " << message << "\n";
+        resetColor();
+        sink().pause(300); // Simulate processing time
+    }
+
+    static void loadingAnimation(const string& message) {
+        if (!enabled()) return;
+        setColor(LIGHT_MAGENTA);
+        cout << " " << message;
+        for (int i = 0; i < 3; i++) {
+            cout << ".";
+            sink().pause(300);
+        }
+        cout << "\n";
+        resetColor();
+    }
+#endif
+
+    static void printAsciiArt() {
+        if (!enabled()) return;
+        setColor(LIGHT_CYAN);
+        cout << R"(
+   ___              _   ___      _ _                 
+  | __|__  ___   __| | |   \ ___| (_)_ _____ _ _ _  
+  | _/ _ \/ _ \ / _` | | |) / -_) | \ V / -_) '_| | 
+  |_|\___/\___/ \__,_| |___/\___|_|_|\_/\___|_| |_| 
+                                                    
+        )" << "\n";
+        resetColor();
+    }
+};
+
+// For log lines built by string concatenation on hot paths: with
+// DISPLAY_NO_DEMO the message expression is never evaluated.
+#ifdef DISPLAY_NO_DEMO
+#define DISPLAY_SYSTEM_LOG(msg) ((void)0)
+#else
+#define DISPLAY_SYSTEM_LOG(msg) Display::printSystemLog(msg)
+#endif
+
+#endif
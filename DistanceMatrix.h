@@ -0,0 +1,155 @@
+#ifndef DISTANCEMATRIX_H
+#define DISTANCEMATRIX_H
+
+#include <thread>
+#include <vector>
+#include "Graph.h"
+#include "ShortestPathEngine.h"
+
+using namespace std;
+
+// ============================================================================
+// DISTANCE MATRIX - All-pairs distances and next hops
+// ============================================================================
+// Runs one Dijkstra per destination (V x Dijkstra) and stores two V*V tables:
+//   dist[s*V + d] - shortest distance from s to d
+//   next[s*V + d] - first vertex after s on that route (-1 if unreachable)
+// Each search runs from d over the reversed graph, so the tree it builds
+// holds every vertex's route *to* d, and a vertex's parent in that tree is
+// its next hop. Following next hops toward one d therefore stays inside one
+// tree and always ends at d, even with zero-weight roads.
+//
+// Lookups are O(1); a path is rebuilt by following next hops, which is
+// O(path length). The tables remember the Graph version they were built from
+// and rebuild themselves on the first query after an addEdge. Large graphs
+// split the destinations across threads, one ShortestPathEngine per thread.
+
+class DistanceMatrix {
+public:
+    static constexpr int UNREACHABLE = ShortestPathEngine::UNREACHABLE;
+
+private:
+    Graph* graph;
+    int numVertices;
+    int* dist;
+    int* next;
+    bool built;
+    unsigned int builtVersion;
+
+    // Fill the columns for destinations first .. last-1
+    void buildColumns(const CSRGraph& rev, int first, int last) {
+        ShortestPathEngine engine(rev);
+        int V = numVertices;
+        for (int d = first; d < last; d++) {
+            engine.solveFrom(d);
+            for (int s = 0; s < V; s++) {
+                long long cell = (long long)s * V + d;
+                dist[cell] = engine.treeDistance(s);
+                next[cell] = s == d ? d : engine.treeParent(s);
+            }
+        }
+    }
+
+    void ensureBuilt() {
+        if (!built || builtVersion != graph->getVersion()) rebuild();
+    }
+
+    bool validVertex(int v) const {
+        return v >= 0 && v < numVertices;
+    }
+
+public:
+    // The graph must outlive the matrix
+    explicit DistanceMatrix(Graph& g)
+        : graph(&g), numVertices(g.getNumVertices()), built(false), builtVersion(0) {
+        dist = new int[(long long)numVertices * numVertices];
+        next = new int[(long long)numVertices * numVertices];
+    }
+
+    ~DistanceMatrix() {
+        delete[] dist;
+        delete[] next;
+    }
+
+    DistanceMatrix(const DistanceMatrix&) = delete;
+    DistanceMatrix& operator=(const DistanceMatrix&) = delete;
+
+    // Recompute both tables now (queries also do this when the graph changed)
+    void rebuild() {
+        const CSRGraph& g = graph->csr();
+        // Undirected graphs are their own reverse
+        CSRGraph* rev = g.isDirected() ? g.reversed() : nullptr;
+        const CSRGraph& searchGraph = rev ? *rev : g;
+
+        int workers = (int)thread::hardware_concurrency();
+        if (workers < 1) workers = 1;
+        // Thread start-up costs more than a small map takes to solve
+        if (workers > numVertices / 64) workers = numVertices / 64;
+
+        if (workers <= 1) {
+            buildColumns(searchGraph, 0, numVertices);
+        } else {
+            // Contiguous blocks, so threads rarely write the same cache line
+            vector<thread> pool;
+            for (int t = 0; t < workers; t++) {
+                int first = (int)((long long)numVertices * t / workers);
+                int last = (int)((long long)numVertices * (t + 1) / workers);
+                pool.emplace_back(&DistanceMatrix::buildColumns, this, ref(searchGraph), first, last);
+            }
+            for (size_t t = 0; t < pool.size(); t++) {
+                pool[t].join();
+            }
+        }
+
+        delete rev;
+        built = true;
+        builtVersion = graph->getVersion();
+    }
+
+    // UNREACHABLE if there is no route
+    int distance(int src, int dest) {
+        if (!validVertex(src) || !validVertex(dest)) {
+            Display::printError("Invalid vertex index");
+            return UNREACHABLE;
+        }
+        ensureBuilt();
+        return dist[(long long)src * numVertices + dest];
+    }
+
+    // Next vertex after src on the shortest route to dest, -1 if none
+    int nextHop(int src, int dest) {
+        if (!validVertex(src) || !validVertex(dest)) {
+            Display::printError("Invalid vertex index");
+            return -1;
+        }
+        ensureBuilt();
+        return next[(long long)src * numVertices + dest];
+    }
+
+    // Fills out with the distance and the route src .. dest
+    bool findRoute(int src, int dest, RouteResult& out) {
+        out.path.clear();
+        out.distance = distance(src, dest);
+        if (out.distance == UNREACHABLE) return false;
+
+        int v = src;
+        out.path.push_back(v);
+        while (v != dest) {
+            v = next[(long long)v * numVertices + dest];
+            out.path.push_back(v);
+        }
+        return true;
+    }
+
+    RouteResult findRoute(int src, int dest) {
+        RouteResult result;
+        findRoute(src, dest, result);
+        return result;
+    }
+
+    int getNumVertices() const {
+        return numVertices;
+    }
+};
+
+#endif
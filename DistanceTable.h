@@ -0,0 +1,124 @@
+#ifndef DISTANCETABLE_H
+#define DISTANCETABLE_H
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "Graph.h"
+#include "ShortestPathEngine.h"
+#include "ContractionHierarchy.h"
+
+using namespace std;
+
+// ============================================================================
+// DISTANCE TABLE - Many-to-many travel distances for batch dispatch
+// ============================================================================
+// Fills an N x M table of shortest distances from N sources (e.g. free
+// agents) to M targets (e.g. pickup sectors). Each source costs one search
+// that stops as soon as all M targets are settled, instead of N x M separate
+// point-to-point queries. Each worker thread owns one ShortestPathEngine, so
+// scratch arrays are allocated once per thread and reused for every row.
+// Workers take the next unclaimed source from a shared counter, which keeps
+// them balanced when some searches are longer than others.
+//
+// With a ContractionHierarchy the table is built from buckets instead
+// (see ContractionHierarchy::manyToMany): every search only climbs the
+// hierarchy, so even a 1000 x 1000 table on a large map takes well under a
+// second.
+
+class DistanceTable {
+public:
+    static constexpr int UNREACHABLE = ShortestPathEngine::UNREACHABLE;
+
+private:
+    int numRows;
+    int numCols;
+    vector<int> cells;   // cells[i * numCols + j] = distance sources[i] -> targets[j]
+
+    void fillRows(const CSRGraph& g, const vector<int>& sources, const vector<int>& targets,
+                  atomic<int>& nextRow) {
+        ShortestPathEngine engine(g);
+        for (;;) {
+            int i = nextRow.fetch_add(1);
+            if (i >= numRows) break;
+            engine.solveTo(sources[i], targets);
+            int* row = &cells[(size_t)i * numCols];
+            for (int j = 0; j < numCols; j++) {
+                row[j] = engine.treeDistance(targets[j]);
+            }
+        }
+    }
+
+public:
+    DistanceTable() : numRows(0), numCols(0) {}
+
+    // Recompute the table. threads = 0 picks one per core; small tables run
+    // on the calling thread since starting threads would cost more.
+    bool compute(Graph& g, const vector<int>& sources, const vector<int>& targets, int threads = 0) {
+        return compute(g.csr(), sources, targets, threads);
+    }
+
+    bool compute(const CSRGraph& csr, const vector<int>& sources, const vector<int>& targets,
+                 int threads = 0) {
+        int V = csr.getNumVertices();
+        for (size_t i = 0; i < sources.size(); i++) {
+            if (sources[i] < 0 || sources[i] >= V) {
+                Display::printError("Invalid source vertex");
+                return false;
+            }
+        }
+        for (size_t j = 0; j < targets.size(); j++) {
+            if (targets[j] < 0 || targets[j] >= V) {
+                Display::printError("Invalid target vertex");
+                return false;
+            }
+        }
+
+        numRows = (int)sources.size();
+        numCols = (int)targets.size();
+        cells.assign((size_t)numRows * numCols, UNREACHABLE);
+        if (numRows == 0 || numCols == 0) return true;
+
+        if (threads <= 0) threads = (int)thread::hardware_concurrency();
+        if (threads < 1) threads = 1;
+        if (threads > numRows / 8) threads = numRows / 8;
+
+        atomic<int> nextRow(0);
+        if (threads <= 1) {
+            fillRows(csr, sources, targets, nextRow);
+        } else {
+            vector<thread> pool;
+            for (int t = 0; t < threads; t++) {
+                pool.emplace_back(&DistanceTable::fillRows, this, ref(csr),
+                                  cref(sources), cref(targets), ref(nextRow));
+            }
+            for (size_t t = 0; t < pool.size(); t++) {
+                pool[t].join();
+            }
+        }
+        return true;
+    }
+
+    // Same table from a prebuilt hierarchy (single-threaded, bucket-based)
+    bool compute(ContractionHierarchy& ch, const vector<int>& sources, const vector<int>& targets) {
+        if (!ch.manyToMany(sources, targets, cells)) return false;
+        numRows = (int)sources.size();
+        numCols = (int)targets.size();
+        return true;
+    }
+
+    // Distance from sources[i] to targets[j]; UNREACHABLE if none
+    int at(int i, int j) const {
+        return cells[(size_t)i * numCols + j];
+    }
+
+    int rows() const {
+        return numRows;
+    }
+
+    int cols() const {
+        return numCols;
+    }
+};
+
+#endif
@@ -0,0 +1,443 @@
+#ifndef DYNAMICMST_H
+#define DYNAMICMST_H
+
+#include <climits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Graph.h"
+#include "MST.h"
+#include "Display.h"
+
+using namespace std;
+
+// ============================================================================
+// DYNAMIC MST - Keeps the delivery network's MST current as roads change
+// ============================================================================
+// The current spanning forest lives in a link-cut tree, where every tree
+// edge is a node of its own sitting between its two sectors and holding
+// the edge's weight. That answers "heaviest edge on the tree path u..v",
+// "are u and v connected", link and cut in O(log V) amortized each.
+//
+//   New edge / lighter non-tree edge (u, v, w): if u and v are in different
+//     trees, link it. Otherwise, if the heaviest tree edge on the path u..v
+//     is heavier than w, swap it out for the new edge (cycle property).
+//   Lighter tree edge: stays in the tree, only its weight changes.
+//   Heavier non-tree edge: only its weight changes.
+//   Heavier tree edge: cut it and find the smaller of the two halves by
+//     walking both halves' tree edges in step until one runs out. The
+//     lightest non-tree edge leaving that half replaces the cut edge if it
+//     is lighter than the new weight; otherwise the edge goes back in. This
+//     is the one step that is not O(log V): it costs O(size of the smaller
+//     half + its edges), which is small unless the cut splits the map.
+//
+// Attached to a Graph, it follows addEdge/updateEdge through GraphListener.
+// Edges are undirected for the MST, as in MST::kruskals. With parallel
+// roads between two sectors, updates go to the first one added, the same
+// one Graph::updateEdge changes.
+
+class DynamicMST : public GraphListener {
+private:
+    // Link-cut tree node: 0 .. V-1 are sectors, V + id is edge id
+    struct Node {
+        int child[2];
+        int parent;     // Splay parent, or path-parent when this is a splay root
+        int maxNode;    // Node with the largest value in this splay subtree
+        bool flip;      // Children still to be swapped (lazy path reversal)
+    };
+
+    Graph* graph;
+    int numVertices;
+    vector<Node> nodes;
+    vector<int> value;          // Edge weight, INT_MIN for sector nodes
+
+    vector<int> edgeFrom;
+    vector<int> edgeTo;
+    vector<bool> inTree;
+    vector<vector<int> > treeAdj;            // Tree edge ids at each sector
+    vector<vector<int> > incident;           // All edge ids at each sector
+    unordered_map<long long, int> firstEdge; // Sector pair -> first edge id
+    long long totalWeight;
+    int treeEdges;
+
+    // Scratch for splay() and for finding the smaller half after a cut
+    vector<int> splayPath;
+    vector<unsigned int> side;  // 2*walk (first half) or 2*walk+1 (second)
+    unsigned int walk;
+    vector<int> halfA;
+    vector<int> halfB;
+
+    // ---------------- Link-cut tree ----------------
+
+    bool isSplayRoot(int x) const {
+        int p = nodes[x].parent;
+        return p < 0 || (nodes[p].child[0] != x && nodes[p].child[1] != x);
+    }
+
+    void pull(int x) {
+        int best = x;
+        for (int side = 0; side < 2; side++) {
+            int c = nodes[x].child[side];
+            if (c >= 0 && value[nodes[c].maxNode] > value[best]) best = nodes[c].maxNode;
+        }
+        nodes[x].maxNode = best;
+    }
+
+    void push(int x) {
+        if (!nodes[x].flip) return;
+        int left = nodes[x].child[0];
+        nodes[x].child[0] = nodes[x].child[1];
+        nodes[x].child[1] = left;
+        for (int side = 0; side < 2; side++) {
+            int c = nodes[x].child[side];
+            if (c >= 0) nodes[c].flip = !nodes[c].flip;
+        }
+        nodes[x].flip = false;
+    }
+
+    void rotate(int x) {
+        int p = nodes[x].parent;
+        int g = nodes[p].parent;
+        int side = nodes[p].child[1] == x ? 1 : 0;
+        int moved = nodes[x].child[1 - side];
+
+        if (!isSplayRoot(p)) {
+            if (nodes[g].child[0] == p) nodes[g].child[0] = x;
+            else nodes[g].child[1] = x;
+        }
+        nodes[x].parent = g;
+        nodes[x].child[1 - side] = p;
+        nodes[p].parent = x;
+        nodes[p].child[side] = moved;
+        if (moved >= 0) nodes[moved].parent = p;
+        pull(p);
+        pull(x);
+    }
+
+    void splay(int x) {
+        // Pending flips above x must be applied top-down first
+        vector<int>& path = splayPath;
+        path.clear();
+        for (int y = x;; y = nodes[y].parent) {
+            path.push_back(y);
+            if (isSplayRoot(y)) break;
+        }
+        for (int i = (int)path.size() - 1; i >= 0; i--) push(path[i]);
+
+        while (!isSplayRoot(x)) {
+            int p = nodes[x].parent;
+            if (!isSplayRoot(p)) {
+                int g = nodes[p].parent;
+                bool zigzig = (nodes[g].child[0] == p) == (nodes[p].child[0] == x);
+                rotate(zigzig ? p : x);
+            }
+            rotate(x);
+        }
+    }
+
+    // Make the tree path root .. x one splay tree, with x at its root
+    void access(int x) {
+        int last = -1;
+        for (int y = x; y >= 0; y = nodes[y].parent) {
+            splay(y);
+            nodes[y].child[1] = last;
+            pull(y);
+            last = y;
+        }
+        splay(x);
+    }
+
+    void makeRoot(int x) {
+        access(x);
+        nodes[x].flip = !nodes[x].flip;
+    }
+
+    int findRoot(int x) {
+        access(x);
+        push(x);
+        while (nodes[x].child[0] >= 0) {
+            x = nodes[x].child[0];
+            push(x);
+        }
+        splay(x);
+        return x;
+    }
+
+    bool connected(int x, int y) {
+        return x == y || findRoot(x) == findRoot(y);
+    }
+
+    void link(int x, int y) {
+        makeRoot(x);
+        nodes[x].parent = y;
+    }
+
+    // x and y must be joined by a tree edge
+    void cut(int x, int y) {
+        makeRoot(x);
+        access(y);
+        nodes[y].child[0] = -1;
+        nodes[x].parent = -1;
+        pull(y);
+    }
+
+    // Node of the heaviest edge on the tree path x .. y
+    int pathMax(int x, int y) {
+        makeRoot(x);
+        access(y);
+        return nodes[y].maxNode;
+    }
+
+    // ---------------- Spanning forest ----------------
+
+    long long pairKey(int u, int v) const {
+        if (!graph->directed() && u > v) {
+            int t = u;
+            u = v;
+            v = t;
+        }
+        return (long long)u * numVertices + v;
+    }
+
+    static void removeId(vector<int>& ids, int id) {
+        for (size_t i = 0; i < ids.size(); i++) {
+            if (ids[i] == id) {
+                ids[i] = ids.back();
+                ids.pop_back();
+                return;
+            }
+        }
+    }
+
+    void linkEdge(int id) {
+        link(edgeFrom[id], numVertices + id);
+        link(numVertices + id, edgeTo[id]);
+        treeAdj[edgeFrom[id]].push_back(id);
+        treeAdj[edgeTo[id]].push_back(id);
+        inTree[id] = true;
+        totalWeight += value[numVertices + id];
+        treeEdges++;
+    }
+
+    void cutEdge(int id) {
+        cut(edgeFrom[id], numVertices + id);
+        cut(numVertices + id, edgeTo[id]);
+        removeId(treeAdj[edgeFrom[id]], id);
+        removeId(treeAdj[edgeTo[id]], id);
+        inTree[id] = false;
+        totalWeight -= value[numVertices + id];
+        treeEdges--;
+    }
+
+    // Edge id is outside the tree with its final weight set: take it in if
+    // it beats the heaviest edge on the cycle it closes
+    void offer(int id) {
+        int u = edgeFrom[id];
+        int v = edgeTo[id];
+        int w = value[numVertices + id];
+        if (!connected(u, v)) {
+            linkEdge(id);
+            return;
+        }
+        int heaviest = pathMax(u, v);
+        if (value[heaviest] > w) {
+            cutEdge(heaviest - numVertices);
+            linkEdge(id);
+        }
+    }
+
+    // Add one more tree neighbour of half's next unexpanded sector;
+    // false once that half has nothing left to expand
+    bool grow(vector<int>& half, size_t& next, unsigned int mark) {
+        if (next == half.size()) return false;
+        int x = half[next++];
+        for (size_t i = 0; i < treeAdj[x].size(); i++) {
+            int e = treeAdj[x][i];
+            int y = edgeFrom[e] == x ? edgeTo[e] : edgeFrom[e];
+            if (side[y] != mark) {
+                side[y] = mark;
+                half.push_back(y);
+            }
+        }
+        return true;
+    }
+
+    // After cutting u-v: lightest non-tree edge between the two halves,
+    // -1 if none. Only the smaller half is walked completely.
+    int lightestReconnect(int u, int v) {
+        walk++;
+        if (walk == 0x7fffffffu) {
+            side.assign(numVertices, 0);
+            walk = 1;
+        }
+        unsigned int markA = 2 * walk;
+        unsigned int markB = 2 * walk + 1;
+        halfA.assign(1, u);
+        halfB.assign(1, v);
+        side[u] = markA;
+        side[v] = markB;
+        size_t nextA = 0;
+        size_t nextB = 0;
+        for (;;) {
+            if (!grow(halfA, nextA, markA)) break;
+            if (!grow(halfB, nextB, markB)) {
+                halfA.swap(halfB);
+                markA = markB;
+                break;
+            }
+        }
+
+        // halfA is now complete; any edge leaving it lands in the other half
+        int best = -1;
+        for (size_t i = 0; i < halfA.size(); i++) {
+            int x = halfA[i];
+            for (size_t k = 0; k < incident[x].size(); k++) {
+                int e = incident[x][k];
+                if (inTree[e]) continue;
+                int y = edgeFrom[e] == x ? edgeTo[e] : edgeFrom[e];
+                if (side[y] == markA) continue;
+                if (best < 0 || value[numVertices + e] < value[numVertices + best]) best = e;
+            }
+        }
+        return best;
+    }
+
+    void setWeight(int id, int weight) {
+        int x = numVertices + id;
+        access(x);
+        value[x] = weight;
+        pull(x);
+    }
+
+    bool validVertex(int v) const {
+        return v >= 0 && v < numVertices;
+    }
+
+public:
+    // Builds the MST of g's current edges and follows later changes.
+    // g must outlive this object.
+    explicit DynamicMST(Graph& g)
+        : graph(&g), numVertices(g.getNumVertices()), totalWeight(0), treeEdges(0), walk(0) {
+        Node blank = {{-1, -1}, -1, 0, false};
+        nodes.assign(numVertices, blank);
+        value.assign(numVertices, INT_MIN);
+        for (int v = 0; v < numVertices; v++) nodes[v].maxNode = v;
+        treeAdj.assign(numVertices, vector<int>());
+        incident.assign(numVertices, vector<int>());
+        side.assign(numVertices, 0);
+
+        const CSRGraph& csr = g.csr();
+        for (int u = 0; u < numVertices; u++) {
+            for (int e = csr.arcBegin(u); e < csr.arcEnd(u); e++) {
+                int v = csr.arcDest(e);
+                // Undirected edges are stored both ways; take each once.
+                // Self-loops can never be tree edges, so they are skipped.
+                if (u != v && (csr.isDirected() || u < v)) {
+                    addEdge(u, v, csr.arcWeight(e));
+                }
+            }
+        }
+        g.addListener(this);
+    }
+
+    ~DynamicMST() {
+        graph->removeListener(this);
+    }
+
+    DynamicMST(const DynamicMST&) = delete;
+    DynamicMST& operator=(const DynamicMST&) = delete;
+
+    // New road; O(log V) amortized
+    void addEdge(int u, int v, int weight) {
+        if (!validVertex(u) || !validVertex(v)) {
+            Display::printError("Invalid vertex index");
+            return;
+        }
+        int id = (int)edgeFrom.size();
+        edgeFrom.push_back(u);
+        edgeTo.push_back(v);
+        inTree.push_back(false);
+        Node blank = {{-1, -1}, -1, numVertices + id, false};
+        nodes.push_back(blank);
+        value.push_back(weight);
+        firstEdge.insert(make_pair(pairKey(u, v), id)); // Keeps an existing entry
+        incident[u].push_back(id);
+        if (v != u) incident[v].push_back(id);
+
+        if (u == v) return; // Self-loops never join two trees
+        offer(id);
+    }
+
+    // Change the weight of the (first) road u-v. False if there is none.
+    bool updateEdge(int u, int v, int weight) {
+        if (!validVertex(u) || !validVertex(v)) {
+            Display::printError("Invalid vertex index");
+            return false;
+        }
+        unordered_map<long long, int>::const_iterator it = firstEdge.find(pairKey(u, v));
+        if (it == firstEdge.end()) return false;
+        int id = it->second;
+        int x = numVertices + id;
+        int old = value[x];
+        if (old == weight) return true;
+
+        if (edgeFrom[id] == edgeTo[id]) {
+            value[x] = weight;
+        } else if (!inTree[id]) {
+            value[x] = weight;
+            if (weight < old) offer(id);
+        } else if (weight < old) {
+            setWeight(id, weight);
+            totalWeight += (long long)weight - old;
+        } else {
+            // Heavier tree edge: look for a lighter way to rejoin the halves
+            cutEdge(id);
+            value[x] = weight;
+            pull(x);
+            int replacement = lightestReconnect(edgeFrom[id], edgeTo[id]);
+            if (replacement >= 0 && value[numVertices + replacement] < weight) {
+                linkEdge(replacement);
+            } else {
+                linkEdge(id);
+            }
+        }
+        return true;
+    }
+
+    // GraphListener
+    void onEdgeAdded(int src, int dest, int weight) override {
+        addEdge(src, dest, weight);
+    }
+
+    void onEdgeWeightChanged(int src, int dest, int, int newWeight) override {
+        updateEdge(src, dest, newWeight);
+    }
+
+    // Sum of tree edge weights (a spanning forest if the map is disconnected)
+    long long getTotalWeight() const {
+        return totalWeight;
+    }
+
+    int getNumTreeEdges() const {
+        return treeEdges;
+    }
+
+    bool inSameTree(int u, int v) {
+        if (!validVertex(u) || !validVertex(v)) return false;
+        return connected(u, v);
+    }
+
+    // Snapshot of the current tree, in the same form as MST::boruvka
+    MSTResult current() const {
+        MSTResult result;
+        for (size_t id = 0; id < edgeFrom.size(); id++) {
+            if (inTree[id]) {
+                result.edges.push_back(EdgeTriple(edgeFrom[id], edgeTo[id], value[numVertices + id]));
+            }
+        }
+        result.totalWeight = totalWeight;
+        return result;
+    }
+};
+
+#endif
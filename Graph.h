@@ -1,70 +1,388 @@
-#ifndef GRAPH_H
-#define GRAPH_H
-
-#include <iostream>
-#include "LinkedList.h"
-#include "Display.h"
-
-using namespace std;
-
-// Simple structure for adjacency list node
-struct Edge {
-    int dest;
-    int weight;
-
-    Edge(int d, int w) : dest(d), weight(w) {}
-    Edge() : dest(0), weight(0) {}
-
-    bool operator==(const Edge& other) const {
-        return dest == other.dest; // Basic comparison for removal
-    }
-
-    friend ostream& operator<<(ostream& os, const Edge& e) {
-        os << "(" << e.dest << ", w:" << e.weight << ")";
-        return os;
-    }
-};
-
-class Graph {
-private:
-    int numVertices;
-    LinkedList<Edge>* adjLists;
-    bool isDirected;
-
-public:
-    Graph(int vertices, bool directed = false) : numVertices(vertices), isDirected(directed) {
-        adjLists = new LinkedList<Edge>[vertices];
-    }
-
-    ~Graph() {
-        delete[] adjLists;
-    }
-
-    void addEdge(int src, int dest, int weight = 1) {
-        if (src >= 0 && src < numVertices && dest >= 0 && dest < numVertices) {
-            adjLists[src].insertTail(Edge(dest, weight));
-            if (!isDirected) {
-                adjLists[dest].insertTail(Edge(src, weight));
-            }
-        } else {
-            Display::printError("Invalid vertex index");
-        }
-    }
-
-    void display() const {
-        for (int i = 0; i < numVertices; i++) {
-            cout << "Vertex " << i << ": ";
-            adjLists[i].display();
-        }
-    }
-
-    LinkedList<Edge>& getAdjList(int vertex) {
-        return adjLists[vertex];
-    }
-
-    int getNumVertices() const {
-        return numVertices;
-    }
-};
-
-#endif
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include "LinkedList.h"
+#include "Display.h"
+
+using namespace std;
+
+// Simple structure for adjacency list node
+struct Edge {
+    int dest;
+    int weight;
+
+    Edge(int d, int w) : dest(d), weight(w) {}
+    Edge() : dest(0), weight(0) {}
+
+    bool operator==(const Edge& other) const {
+        return dest == other.dest; // Basic comparison for removal
+    }
+
+    friend ostream& operator<<(ostream& os, const Edge& e) {
+        os << "(" << e.dest << ", w:" << e.weight << ")";
+        return os;
+    }
+};
+
+// ============================================================================
+// CSR GRAPH - Frozen compressed sparse row form of a Graph
+// ============================================================================
+// All arcs are packed into two parallel arrays (dests, weights), grouped by
+// source vertex; the arcs leaving u are indices offsets[u] .. offsets[u+1]-1.
+// Scanning a vertex's neighbours is a linear walk over contiguous memory
+// instead of chasing one list node per edge. Undirected edges appear once
+// in each direction, in the same order as the Graph's adjacency lists.
+//
+// If the Graph has vertex positions they are copied too, together with a
+// scale chosen so that scale * straight-line distance never exceeds the
+// road distance along any arc. That makes straightLine() a safe A* estimate.
+//
+// A CSRGraph can also be opened straight from a binary map file (see
+// RoadMapIO.h); its arrays then point into the mapped file instead of
+// being allocated here.
+
+class CSRGraph {
+private:
+    int numVertices;
+    int numArcs;
+    bool directed;
+    int* offsets;  // numVertices + 1 entries
+    int* dests;    // numArcs entries
+    int* weights;  // numArcs entries
+    double* xs;    // Vertex positions, nullptr if the graph has none
+    double* ys;
+    double scale;  // Largest factor that keeps straightLine() <= road distance
+
+    // Set when the arrays live in one external block (e.g. a memory-mapped
+    // file) that is released as a whole instead of with delete[]
+    void* block;
+    size_t blockBytes;
+    void (*releaseBlock)(void*, size_t);
+
+    friend class Graph;
+    friend class RoadMapIO;
+    friend class IncrementalSSSP;
+
+    // Called once all arcs and positions are filled in
+    void computeScale() {
+        scale = 0;
+        if (!xs) return;
+        bool first = true;
+        for (int u = 0; u < numVertices; u++) {
+            for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+                double dx = xs[u] - xs[dests[e]];
+                double dy = ys[u] - ys[dests[e]];
+                double len = sqrt(dx * dx + dy * dy);
+                if (len <= 0) continue;
+                double ratio = weights[e] / len;
+                if (first || ratio < scale) scale = ratio;
+                first = false;
+            }
+        }
+        if (scale < 0) scale = 0;
+    }
+
+    // Patch one weight in place (traffic update). A lighter arc may need a
+    // smaller scale to keep straightLine() a lower bound; a heavier one
+    // leaves the old scale valid, just slightly less tight.
+    void setArcWeight(int u, int e, int weight) {
+        weights[e] = weight;
+        if (!xs) return;
+        double dx = xs[u] - xs[dests[e]];
+        double dy = ys[u] - ys[dests[e]];
+        double len = sqrt(dx * dx + dy * dy);
+        if (len > 0 && weight / len < scale) scale = weight < 0 ? 0 : weight / len;
+    }
+
+public:
+    CSRGraph(int vertices = 0, int arcs = 0, bool isDirected = false)
+        : numVertices(vertices), numArcs(arcs), directed(isDirected),
+          xs(nullptr), ys(nullptr), scale(0),
+          block(nullptr), blockBytes(0), releaseBlock(nullptr) {
+        offsets = new int[vertices + 1];
+        dests = new int[arcs > 0 ? arcs : 1];
+        weights = new int[arcs > 0 ? arcs : 1];
+        for (int i = 0; i <= vertices; i++) offsets[i] = 0;
+    }
+
+    ~CSRGraph() {
+        if (releaseBlock) {
+            releaseBlock(block, blockBytes);
+            return;
+        }
+        delete[] offsets;
+        delete[] dests;
+        delete[] weights;
+        delete[] xs;
+        delete[] ys;
+    }
+
+    CSRGraph(const CSRGraph&) = delete;
+    CSRGraph& operator=(const CSRGraph&) = delete;
+
+    int getNumVertices() const { return numVertices; }
+    int getNumArcs() const { return numArcs; }
+    bool isDirected() const { return directed; }
+
+    // Arc index range [arcBegin(u), arcEnd(u)) for vertex u
+    int arcBegin(int u) const { return offsets[u]; }
+    int arcEnd(int u) const { return offsets[u + 1]; }
+    int degree(int u) const { return offsets[u + 1] - offsets[u]; }
+
+    int arcDest(int e) const { return dests[e]; }
+    int arcWeight(int e) const { return weights[e]; }
+
+    // First arc u -> v, or -1 if there is none
+    int findArc(int u, int v) const {
+        for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+            if (dests[e] == v) return e;
+        }
+        return -1;
+    }
+
+    bool hasPositions() const { return xs != nullptr; }
+
+    // Position of v; false if the graph has none
+    bool getPosition(int v, double& x, double& y) const {
+        if (!xs) return false;
+        x = xs[v];
+        y = ys[v];
+        return true;
+    }
+
+    // Lower bound on the road distance from u to v (0 without positions).
+    // Rounded down, so with integer weights it stays consistent for A*.
+    int straightLine(int u, int v) const {
+        if (!xs) return 0;
+        double dx = xs[u] - xs[v];
+        double dy = ys[u] - ys[v];
+        return (int)floor(scale * sqrt(dx * dx + dy * dy));
+    }
+
+    // New graph with every arc flipped (v -> u for each u -> v); the caller
+    // deletes it. Searching it from t answers "distance from anywhere to t".
+    CSRGraph* reversed() const {
+        CSRGraph* rev = new CSRGraph(numVertices, numArcs, directed);
+        // Count in-degrees, then turn them into row starts
+        for (int e = 0; e < numArcs; e++) rev->offsets[dests[e] + 1]++;
+        for (int v = 0; v < numVertices; v++) rev->offsets[v + 1] += rev->offsets[v];
+
+        int* fill = new int[numVertices];
+        for (int v = 0; v < numVertices; v++) fill[v] = rev->offsets[v];
+        for (int u = 0; u < numVertices; u++) {
+            for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+                int slot = fill[dests[e]]++;
+                rev->dests[slot] = u;
+                rev->weights[slot] = weights[e];
+            }
+        }
+        delete[] fill;
+
+        if (xs) {
+            rev->xs = new double[numVertices];
+            rev->ys = new double[numVertices];
+            for (int v = 0; v < numVertices; v++) {
+                rev->xs[v] = xs[v];
+                rev->ys[v] = ys[v];
+            }
+            rev->scale = scale;
+        }
+        return rev;
+    }
+};
+
+// Anything that must follow edge changes as they happen (e.g. DynamicMST)
+// registers with Graph::addListener. Version checks only say *that* the
+// graph changed; listeners are told *which* edge changed.
+class GraphListener {
+public:
+    virtual ~GraphListener() {}
+    virtual void onEdgeAdded(int src, int dest, int weight) = 0;
+    virtual void onEdgeWeightChanged(int src, int dest, int oldWeight, int newWeight) = 0;
+};
+
+class Graph {
+private:
+    int numVertices;
+    LinkedList<Edge>* adjLists;
+    bool isDirected;
+    int numArcs;
+    CSRGraph* frozen; // Cached CSR form, rebuilt after the next addEdge
+    unsigned int version; // Bumped by every edge or position change, for caches built on top
+    double* posX;     // Optional vertex positions (e.g. map coordinates)
+    double* posY;
+    vector<GraphListener*> listeners;
+
+public:
+    Graph(int vertices, bool directed = false)
+        : numVertices(vertices), isDirected(directed), numArcs(0), frozen(nullptr), version(0),
+          posX(nullptr), posY(nullptr) {
+        adjLists = new LinkedList<Edge>[vertices];
+    }
+
+    ~Graph() {
+        delete frozen;
+        delete[] adjLists;
+        delete[] posX;
+        delete[] posY;
+    }
+
+    Graph(const Graph&) = delete;
+    Graph& operator=(const Graph&) = delete;
+
+    void addEdge(int src, int dest, int weight = 1) {
+        if (src >= 0 && src < numVertices && dest >= 0 && dest < numVertices) {
+            adjLists[src].insertTail(Edge(dest, weight));
+            numArcs++;
+            if (!isDirected) {
+                adjLists[dest].insertTail(Edge(src, weight));
+                numArcs++;
+            }
+            delete frozen;
+            frozen = nullptr;
+            version++;
+            for (size_t i = 0; i < listeners.size(); i++) {
+                listeners[i]->onEdgeAdded(src, dest, weight);
+            }
+        } else {
+            Display::printError("Invalid vertex index");
+        }
+    }
+
+    // Change the weight of the first src -> dest edge (and its twin when
+    // undirected), e.g. when traffic changes a road's travel time. The CSR
+    // snapshot is patched in place rather than rebuilt, and listeners are
+    // told. False if there is no such edge.
+    bool updateEdge(int src, int dest, int weight) {
+        if (src < 0 || src >= numVertices || dest < 0 || dest >= numVertices) {
+            Display::printError("Invalid vertex index");
+            return false;
+        }
+        Node<Edge>* forward = adjLists[src].getHead();
+        while (forward && forward->data.dest != dest) forward = forward->next;
+        if (!forward) return false;
+
+        int oldWeight = forward->data.weight;
+        forward->data.weight = weight;
+        int e = frozen ? frozen->findArc(src, dest) : -1;
+        if (e >= 0) frozen->setArcWeight(src, e, weight);
+
+        if (!isDirected) {
+            // addEdge inserted both copies in the same order, so the first
+            // dest -> src copy is the twin (for a self-loop, the next one)
+            Node<Edge>* twin = src == dest ? forward->next : adjLists[dest].getHead();
+            while (twin && twin->data.dest != src) twin = twin->next;
+            if (twin) twin->data.weight = weight;
+            int t = -1;
+            if (frozen) t = src == dest ? e + 1 : frozen->findArc(dest, src);
+            if (t >= 0) frozen->setArcWeight(dest, t, weight);
+        }
+
+        version++;
+        for (size_t i = 0; i < listeners.size(); i++) {
+            listeners[i]->onEdgeWeightChanged(src, dest, oldWeight, weight);
+        }
+        return true;
+    }
+
+    // Current weight of the first src -> dest edge, -1 if there is none
+    int getEdgeWeight(int src, int dest) const {
+        if (src < 0 || src >= numVertices) return -1;
+        for (Node<Edge>* temp = adjLists[src].getHead(); temp; temp = temp->next) {
+            if (temp->data.dest == dest) return temp->data.weight;
+        }
+        return -1;
+    }
+
+    // The listener must unregister (removeListener) before it is destroyed
+    void addListener(GraphListener* listener) {
+        listeners.push_back(listener);
+    }
+
+    void removeListener(GraphListener* listener) {
+        for (size_t i = 0; i < listeners.size(); i++) {
+            if (listeners[i] == listener) {
+                listeners.erase(listeners.begin() + i);
+                return;
+            }
+        }
+    }
+
+    // Place a vertex on the plane; used by A* as a distance estimate.
+    // Any unit works, the CSR snapshot rescales it against road weights.
+    void setPosition(int vertex, double x, double y) {
+        if (vertex < 0 || vertex >= numVertices) {
+            Display::printError("Invalid vertex index");
+            return;
+        }
+        if (!posX) {
+            posX = new double[numVertices];
+            posY = new double[numVertices];
+            for (int i = 0; i < numVertices; i++) {
+                posX[i] = 0;
+                posY[i] = 0;
+            }
+        }
+        posX[vertex] = x;
+        posY[vertex] = y;
+        delete frozen;
+        frozen = nullptr;
+        version++;   // Reversed copies carry positions and the A* scale too
+    }
+
+    // CSR snapshot of the current edges, built on first use after a change
+    const CSRGraph& csr() {
+        if (!frozen) {
+            frozen = new CSRGraph(numVertices, numArcs, isDirected);
+            int e = 0;
+            for (int u = 0; u < numVertices; u++) {
+                frozen->offsets[u] = e;
+                for (Node<Edge>* temp = adjLists[u].getHead(); temp; temp = temp->next) {
+                    frozen->dests[e] = temp->data.dest;
+                    frozen->weights[e] = temp->data.weight;
+                    e++;
+                }
+            }
+            frozen->offsets[numVertices] = e;
+            if (posX) {
+                frozen->xs = new double[numVertices];
+                frozen->ys = new double[numVertices];
+                for (int v = 0; v < numVertices; v++) {
+                    frozen->xs[v] = posX[v];
+                    frozen->ys[v] = posY[v];
+                }
+                frozen->computeScale();
+            }
+        }
+        return *frozen;
+    }
+
+    void display() const {
+        for (int i = 0; i < numVertices; i++) {
+            cout << "Vertex " << i << ": ";
+            adjLists[i].display();
+        }
+    }
+
+    LinkedList<Edge>& getAdjList(int vertex) {
+        return adjLists[vertex];
+    }
+
+    int getNumVertices() const {
+        return numVertices;
+    }
+
+    bool directed() const {
+        return isDirected;
+    }
+
+    // Changes whenever an edge or a vertex position changes
+    unsigned int getVersion() const {
+        return version;
+    }
+};
+
+#endif
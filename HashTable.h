@@ -0,0 +1,176 @@
+#ifndef HASHTABLE_H
+#define HASHTABLE_H
+
+#include <functional>
+#include <utility>
+#include <cstddef>
+
+using namespace std;
+
+// ============================================================================
+// HASH TABLE - Open addressing with linear probing
+// ============================================================================
+// Slots live in one contiguous array, so a lookup is a hash plus a short scan
+// of neighbouring slots (no per-entry node allocation). Each slot caches the
+// full hash so most mismatches are rejected without comparing keys.
+// Removed entries leave a tombstone; the table is rebuilt once live entries
+// plus tombstones pass 70% of the capacity.
+
+template <typename K, typename V, typename Hasher = hash<K>>
+class HashTable {
+private:
+    enum SlotState : unsigned char { EMPTY = 0, FULL = 1, DELETED = 2 };
+
+    struct Slot {
+        K key;
+        V value;
+        size_t hashCode;
+        SlotState state;
+
+        Slot() : key(), value(), hashCode(0), state(EMPTY) {}
+    };
+
+    Slot* slots;
+    size_t capacity; // Always a power of two
+    size_t count;
+    size_t tombstones;
+    Hasher hasher;
+
+    size_t findSlot(const K& key, size_t h) const {
+        size_t mask = capacity - 1;
+        size_t i = h & mask;
+        while (slots[i].state != EMPTY) {
+            if (slots[i].state == FULL && slots[i].hashCode == h && slots[i].key == key) {
+                return i;
+            }
+            i = (i + 1) & mask;
+        }
+        return capacity; // Not found
+    }
+
+    void rehash(size_t newCapacity) {
+        Slot* old = slots;
+        size_t oldCapacity = capacity;
+
+        slots = new Slot[newCapacity];
+        capacity = newCapacity;
+        tombstones = 0;
+
+        size_t mask = capacity - 1;
+        for (size_t j = 0; j < oldCapacity; j++) {
+            if (old[j].state != FULL) continue;
+            size_t i = old[j].hashCode & mask;
+            while (slots[i].state != EMPTY) {
+                i = (i + 1) & mask;
+            }
+            slots[i].key = std::move(old[j].key);
+            slots[i].value = std::move(old[j].value);
+            slots[i].hashCode = old[j].hashCode;
+            slots[i].state = FULL;
+        }
+        delete[] old;
+    }
+
+    void growIfNeeded() {
+        if ((count + tombstones + 1) * 10 > capacity * 7) {
+            // Only grow if live entries need it; otherwise just clear tombstones
+            rehash((count + 1) * 10 > capacity * 5 ? capacity * 2 : capacity);
+        }
+    }
+
+public:
+    HashTable(size_t initialCapacity = 16) : slots(nullptr), capacity(16), count(0), tombstones(0) {
+        while (capacity < initialCapacity) capacity *= 2;
+        slots = new Slot[capacity];
+    }
+
+    ~HashTable() {
+        delete[] slots;
+    }
+
+    HashTable(const HashTable&) = delete;
+    HashTable& operator=(const HashTable&) = delete;
+
+    // Make room for n entries without rehashing along the way
+    void reserve(size_t n) {
+        size_t needed = capacity;
+        while (n * 10 > needed * 7) needed *= 2;
+        if (needed != capacity) rehash(needed);
+    }
+
+    // Insert or overwrite. Returns false if the key already existed.
+    bool insert(const K& key, const V& value) {
+        growIfNeeded();
+        size_t h = hasher(key);
+        size_t mask = capacity - 1;
+        size_t i = h & mask;
+        size_t firstFree = capacity;
+
+        while (slots[i].state != EMPTY) {
+            if (slots[i].state == FULL) {
+                if (slots[i].hashCode == h && slots[i].key == key) {
+                    slots[i].value = value;
+                    return false;
+                }
+            } else if (firstFree == capacity) {
+                firstFree = i; // Reuse the first tombstone on the probe path
+            }
+            i = (i + 1) & mask;
+        }
+
+        if (firstFree != capacity) {
+            i = firstFree;
+            tombstones--;
+        }
+        slots[i].key = key;
+        slots[i].value = value;
+        slots[i].hashCode = h;
+        slots[i].state = FULL;
+        count++;
+        return true;
+    }
+
+    // Value for key, default-constructing it first if absent
+    V& operator[](const K& key) {
+        V* existing = find(key);
+        if (existing) return *existing;
+        insert(key, V());
+        return *find(key);
+    }
+
+    // Pointer to the stored value, or nullptr if absent
+    V* find(const K& key) {
+        size_t i = findSlot(key, hasher(key));
+        return i == capacity ? nullptr : &slots[i].value;
+    }
+
+    const V* find(const K& key) const {
+        size_t i = findSlot(key, hasher(key));
+        return i == capacity ? nullptr : &slots[i].value;
+    }
+
+    bool contains(const K& key) const {
+        return find(key) != nullptr;
+    }
+
+    bool remove(const K& key) {
+        size_t i = findSlot(key, hasher(key));
+        if (i == capacity) return false;
+        slots[i].state = DELETED;
+        slots[i].key = K();
+        slots[i].value = V();
+        count--;
+        tombstones++;
+        return true;
+    }
+
+    int size() const {
+        return (int)count;
+    }
+
+    bool isEmpty() const {
+        return count == 0;
+    }
+};
+
+#endif
@@ -1,92 +1,131 @@
-#ifndef HEAP_H
-#define HEAP_H
-
-#include <iostream>
-#include "Display.h"
-
-template <typename T>
-class Heap {
-private:
-    T* arr;
-    int capacity;
-    int currentSize;
-
-    void heapify(int i) {
-        int smallest = i;
-        int left = 2 * i + 1;
-        int right = 2 * i + 2;
-
-        if (left < currentSize && arr[left] < arr[smallest])
-            smallest = left;
-
-        if (right < currentSize && arr[right] < arr[smallest])
-            smallest = right;
-
-        if (smallest != i) {
-            T temp = arr[i];
-            arr[i] = arr[smallest];
-            arr[smallest] = temp;
-            heapify(smallest);
-        }
-    }
-
-public:
-    Heap(int cap = 100) : capacity(cap), currentSize(0) {
-        arr = new T[capacity];
-    }
-
-    ~Heap() {
-        delete[] arr;
-    }
-
-    void insert(T val) {
-        if (currentSize == capacity) {
-            Display::printError("Heap Overflow");
-            return;
-        }
-
-        currentSize++;
-        int i = currentSize - 1;
-        arr[i] = val;
-
-        while (i != 0 && arr[(i - 1) / 2] > arr[i]) {
-            T temp = arr[i];
-            arr[i] = arr[(i - 1) / 2];
-            arr[(i - 1) / 2] = temp;
-            i = (i - 1) / 2;
-        }
-    }
-
-    T extractMin() {
-        if (currentSize <= 0) {
-            Display::printError("Heap Underflow");
-            return T(); 
-        }
-        if (currentSize == 1) {
-            currentSize--;
-            return arr[0];
-        }
-
-        T root = arr[0];
-        arr[0] = arr[currentSize - 1];
-        currentSize--;
-        heapify(0);
-
-        return root;
-    }
-
-    T getMin() const {
-        if (currentSize <= 0) return T();
-        return arr[0];
-    }
-
-    bool isEmpty() const {
-        return currentSize == 0;
-    }
-
-    int size() const {
-        return currentSize;
-    }
-};
-
-#endif
+#ifndef HEAP_H
+#define HEAP_H
+
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include "Display.h"
+
+// ============================================================================
+// MIN-HEAP (Priority Queue)
+// ============================================================================
+// Array-backed D-ary min-heap ordered by operator<. The array doubles when
+// full, so inserts never fail. D = 2 is the classic binary heap; D = 4 makes
+// the tree shallower and keeps a node's children in one cache line, which
+// usually wins for Dijkstra/Prim-sized workloads.
+
+template <typename T, int D = 2>
+class Heap {
+private:
+    static_assert(D >= 2, "Heap arity must be at least 2");
+
+    T* arr;
+    int capacity;
+    int currentSize;
+
+    void grow() {
+        int newCapacity = capacity > 0 ? capacity * 2 : 16;
+        T* newArr = new T[newCapacity];
+        for (int i = 0; i < currentSize; i++) {
+            newArr[i] = std::move(arr[i]);
+        }
+        delete[] arr;
+        arr = newArr;
+        capacity = newCapacity;
+    }
+
+    // Move the element at i up until its parent is not larger
+    void siftUp(int i) {
+        T val = std::move(arr[i]);
+        while (i > 0) {
+            int parent = (i - 1) / D;
+            if (!(val < arr[parent])) break;
+            arr[i] = std::move(arr[parent]);
+            i = parent;
+        }
+        arr[i] = std::move(val);
+    }
+
+    // Move the element at i down until no child is smaller
+    void heapify(int i) {
+        T val = std::move(arr[i]);
+        for (;;) {
+            int first = D * i + 1;
+            if (first >= currentSize) break;
+            int last = first + D < currentSize ? first + D : currentSize;
+            int smallest = first;
+            for (int c = first + 1; c < last; c++) {
+                if (arr[c] < arr[smallest]) smallest = c;
+            }
+            if (!(arr[smallest] < val)) break;
+            arr[i] = std::move(arr[smallest]);
+            i = smallest;
+        }
+        arr[i] = std::move(val);
+    }
+
+public:
+    Heap(int cap = 100) : capacity(cap > 0 ? cap : 1), currentSize(0) {
+        arr = new T[capacity];
+    }
+
+    ~Heap() {
+        delete[] arr;
+    }
+
+    Heap(const Heap&) = delete;
+    Heap& operator=(const Heap&) = delete;
+
+    void insert(const T& val) {
+        insert(T(val));
+    }
+
+    void insert(T&& val) {
+        if (currentSize == capacity) grow();
+        arr[currentSize] = std::move(val);
+        siftUp(currentSize);
+        currentSize++;
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        insert(T(std::forward<Args>(args)...));
+    }
+
+    T extractMin() {
+        if (currentSize <= 0) {
+            Display::printError("Heap Underflow");
+            return T();
+        }
+
+        T root = std::move(arr[0]);
+        currentSize--;
+        if (currentSize > 0) {
+            arr[0] = std::move(arr[currentSize]);
+            heapify(0);
+        }
+        return root;
+    }
+
+    // Caller should check isEmpty
+    const T& getMin() const {
+        if (currentSize <= 0) {
+            throw out_of_range("Heap is empty");
+        }
+        return arr[0];
+    }
+
+    void clear() {
+        currentSize = 0;
+    }
+
+    bool isEmpty() const {
+        return currentSize == 0;
+    }
+
+    int size() const {
+        return currentSize;
+    }
+};
+
+#endif
@@ -0,0 +1,247 @@
+#ifndef INCREMENTALSSSP_H
+#define INCREMENTALSSSP_H
+
+#include <vector>
+#include "Graph.h"
+#include "IndexedHeap.h"
+#include "ShortestPathEngine.h"
+#include "Display.h"
+
+using namespace std;
+
+// ============================================================================
+// INCREMENTAL SSSP - A depot's shortest-path tree that repairs itself
+// ============================================================================
+// Keeps dist[] and parent[] from one source up to date while road weights
+// change (Graph::updateEdge, e.g. traffic) or roads are added. Instead of a
+// full Dijkstra rerun, each change only touches the vertices whose distance
+// can actually change:
+//
+//   Cheaper road u -> v: if it shortens the route to v, run Dijkstra from v
+//     alone; it stops spreading wherever the old distances still win.
+//   Dearer road u -> v: nothing to do unless it is v's tree edge. If it is,
+//     every vertex in v's subtree loses its distance. Each of them takes
+//     the best offer from a neighbour outside the subtree, and Dijkstra
+//     restricted to the subtree settles the rest.
+//
+// Both cost O(affected vertices and their roads * log V); lastRepairCount()
+// reports how many vertices one update touched. Undirected roads are
+// repaired in both directions.
+//
+// Adding roads rebuilds the Graph's CSR snapshot, so attach after the map
+// is loaded when adding many roads at once.
+
+class IncrementalSSSP : public GraphListener {
+public:
+    static constexpr int UNREACHABLE = ShortestPathEngine::UNREACHABLE;
+
+private:
+    Graph* graph;
+    int numVertices;
+    int source;
+    int* dist;
+    int* parent;
+    unsigned int* affected;   // Stamp: in the subtree being repaired
+    unsigned int repairId;
+    IndexedHeap<int> heap;
+    vector<int> subtree;
+    int repairCount;
+
+    // In-arcs for directed graphs (undirected ones are their own reverse),
+    // patched on weight changes and rebuilt after addEdge
+    CSRGraph* reverse;
+    unsigned int reverseVersion;
+
+    const CSRGraph& inArcs() {
+        const CSRGraph& g = graph->csr();
+        if (!g.isDirected()) return g;
+        if (!reverse || reverseVersion != graph->getVersion()) {
+            delete reverse;
+            reverse = g.reversed();
+            reverseVersion = graph->getVersion();
+        }
+        return *reverse;
+    }
+
+    // Dijkstra from whatever is in the heap; only improvements spread
+    void propagate() {
+        const CSRGraph& g = graph->csr();
+        while (!heap.isEmpty()) {
+            int u = heap.extractMin();
+            repairCount++;
+            for (int e = g.arcBegin(u); e < g.arcEnd(u); e++) {
+                int v = g.arcDest(e);
+                long long nd = (long long)dist[u] + g.arcWeight(e);
+                if (nd < dist[v]) {
+                    dist[v] = (int)nd;
+                    parent[v] = u;
+                    heap.push(v, dist[v]);
+                }
+            }
+        }
+    }
+
+    void arcLighter(int u, int v, int weight) {
+        if (dist[u] == UNREACHABLE) return;
+        long long nd = (long long)dist[u] + weight;
+        if (nd >= dist[v]) return;
+        dist[v] = (int)nd;
+        parent[v] = u;
+        heap.push(v, dist[v]);
+        propagate();
+    }
+
+    void arcHeavier(int u, int v) {
+        if (parent[v] != u) return; // Not on any current shortest route
+
+        const CSRGraph& g = graph->csr();
+        repairId++;
+        if (repairId == 0) {
+            for (int i = 0; i < numVertices; i++) affected[i] = 0;
+            repairId = 1;
+        }
+
+        // v's subtree: children are out-neighbours whose parent is the vertex
+        subtree.clear();
+        subtree.push_back(v);
+        affected[v] = repairId;
+        for (size_t i = 0; i < subtree.size(); i++) {
+            int x = subtree[i];
+            for (int e = g.arcBegin(x); e < g.arcEnd(x); e++) {
+                int y = g.arcDest(e);
+                if (parent[y] == x && affected[y] != repairId) {
+                    affected[y] = repairId;
+                    subtree.push_back(y);
+                }
+            }
+        }
+        for (size_t i = 0; i < subtree.size(); i++) {
+            dist[subtree[i]] = UNREACHABLE;
+            parent[subtree[i]] = -1;
+        }
+        repairCount += (int)subtree.size();
+
+        // Best way in from outside the subtree (all of those are still exact)
+        const CSRGraph& in = inArcs();
+        for (size_t i = 0; i < subtree.size(); i++) {
+            int x = subtree[i];
+            for (int e = in.arcBegin(x); e < in.arcEnd(x); e++) {
+                int y = in.arcDest(e);
+                if (affected[y] == repairId || dist[y] == UNREACHABLE) continue;
+                long long nd = (long long)dist[y] + in.arcWeight(e);
+                if (nd < dist[x]) {
+                    dist[x] = (int)nd;
+                    parent[x] = y;
+                }
+            }
+            if (dist[x] != UNREACHABLE) heap.push(x, dist[x]);
+        }
+        propagate();
+    }
+
+    void arcChanged(int u, int v, int oldWeight, int newWeight) {
+        if (newWeight < oldWeight) arcLighter(u, v, newWeight);
+        else if (newWeight > oldWeight) arcHeavier(u, v);
+    }
+
+    bool validVertex(int v) const {
+        return v >= 0 && v < numVertices;
+    }
+
+public:
+    // Solves from src now and follows g's later changes; g must outlive this
+    IncrementalSSSP(Graph& g, int src)
+        : graph(&g), numVertices(g.getNumVertices()), source(src), repairId(0),
+          heap(g.getNumVertices() > 0 ? g.getNumVertices() : 1), repairCount(0),
+          reverse(nullptr), reverseVersion(0) {
+        dist = new int[numVertices > 0 ? numVertices : 1];
+        parent = new int[numVertices > 0 ? numVertices : 1];
+        affected = new unsigned int[numVertices > 0 ? numVertices : 1];
+        for (int i = 0; i < numVertices; i++) affected[i] = 0;
+        if (!validVertex(src)) {
+            Display::printError("Invalid source vertex");
+            source = -1;
+        }
+        recompute();
+        g.addListener(this);
+    }
+
+    ~IncrementalSSSP() {
+        graph->removeListener(this);
+        delete[] dist;
+        delete[] parent;
+        delete[] affected;
+        delete reverse;
+    }
+
+    IncrementalSSSP(const IncrementalSSSP&) = delete;
+    IncrementalSSSP& operator=(const IncrementalSSSP&) = delete;
+
+    // Full Dijkstra from the source (normally never needed)
+    void recompute() {
+        for (int i = 0; i < numVertices; i++) {
+            dist[i] = UNREACHABLE;
+            parent[i] = -1;
+        }
+        repairCount = 0;
+        if (source < 0) return;
+        dist[source] = 0;
+        heap.push(source, 0);
+        propagate();
+    }
+
+    // GraphListener: both fire after the Graph has changed
+    void onEdgeAdded(int src, int dest, int weight) override {
+        repairCount = 0;
+        arcLighter(src, dest, weight);
+        if (!graph->directed()) arcLighter(dest, src, weight);
+    }
+
+    void onEdgeWeightChanged(int src, int dest, int oldWeight, int newWeight) override {
+        repairCount = 0;
+        // Keep the reverse arcs in step without a rebuild
+        if (reverse && reverseVersion + 1 == graph->getVersion()) {
+            int e = reverse->findArc(dest, src);
+            if (e >= 0) reverse->setArcWeight(dest, e, newWeight);
+            reverseVersion++;
+        }
+        arcChanged(src, dest, oldWeight, newWeight);
+        if (!graph->directed()) arcChanged(dest, src, oldWeight, newWeight);
+    }
+
+    int getSource() const {
+        return source;
+    }
+
+    // UNREACHABLE if v cannot be reached from the source
+    int distance(int v) const {
+        return validVertex(v) ? dist[v] : UNREACHABLE;
+    }
+
+    // Previous vertex on the route to v, -1 for the source or unreachable
+    int parentOf(int v) const {
+        return validVertex(v) ? parent[v] : -1;
+    }
+
+    bool findRoute(int dest, RouteResult& out) const {
+        out.path.clear();
+        out.distance = distance(dest);
+        if (out.distance == UNREACHABLE) return false;
+        for (int v = dest; v != -1; v = parent[v]) {
+            out.path.push_back(v);
+        }
+        for (size_t i = 0, j = out.path.size() - 1; i < j; i++, j--) {
+            int t = out.path[i];
+            out.path[i] = out.path[j];
+            out.path[j] = t;
+        }
+        return true;
+    }
+
+    // Vertices settled or reset by the last update (or by recompute())
+    int lastRepairCount() const {
+        return repairCount;
+    }
+};
+
+#endif
@@ -0,0 +1,187 @@
+#ifndef INDEXEDHEAP_H
+#define INDEXEDHEAP_H
+
+#include <stdexcept>
+#include "Display.h"
+
+// ============================================================================
+// INDEXED MIN-HEAP (Priority Queue with decrease-key)
+// ============================================================================
+// Holds item IDs 0..n-1 (graph vertices), each with a priority Key. pos[id]
+// remembers where an item sits in the heap array, so contains() is O(1) and
+// decreaseKey() can sift an existing entry up instead of pushing a duplicate.
+// That keeps the heap at most n entries for Dijkstra and Prim's, and no
+// "already visited" entries are ever popped. D is the arity (4 by default).
+
+template <typename Key, int D = 4>
+class IndexedHeap {
+private:
+    static_assert(D >= 2, "Heap arity must be at least 2");
+
+    // Keys are stored next to the IDs so sifting never leaves the heap array
+    struct Entry {
+        Key key;
+        int id;
+    };
+
+    Entry* heap;    // heap[i] = entry at position i
+    int* pos;       // pos[id] = position of id in heap, -1 if absent
+    int maxItems;
+    int currentSize;
+
+    void place(int i, const Entry& e) {
+        heap[i] = e;
+        pos[e.id] = i;
+    }
+
+    void siftUp(int i) {
+        Entry e = heap[i];
+        while (i > 0) {
+            int parent = (i - 1) / D;
+            if (!(e.key < heap[parent].key)) break;
+            place(i, heap[parent]);
+            i = parent;
+        }
+        place(i, e);
+    }
+
+    void siftDown(int i) {
+        Entry e = heap[i];
+        for (;;) {
+            int first = D * i + 1;
+            if (first >= currentSize) break;
+            int last = first + D < currentSize ? first + D : currentSize;
+            int smallest = first;
+            for (int c = first + 1; c < last; c++) {
+                if (heap[c].key < heap[smallest].key) smallest = c;
+            }
+            if (!(heap[smallest].key < e.key)) break;
+            place(i, heap[smallest]);
+            i = smallest;
+        }
+        place(i, e);
+    }
+
+public:
+    IndexedHeap(int n) : maxItems(n), currentSize(0) {
+        heap = new Entry[n];
+        pos = new int[n];
+        for (int i = 0; i < n; i++) pos[i] = -1;
+    }
+
+    ~IndexedHeap() {
+        delete[] heap;
+        delete[] pos;
+    }
+
+    IndexedHeap(const IndexedHeap&) = delete;
+    IndexedHeap& operator=(const IndexedHeap&) = delete;
+
+    bool contains(int id) const {
+        return id >= 0 && id < maxItems && pos[id] != -1;
+    }
+
+    void insert(int id, const Key& key) {
+        if (id < 0 || id >= maxItems || contains(id)) {
+            Display::printError("IndexedHeap: invalid or duplicate id");
+            return;
+        }
+        heap[currentSize].key = key;
+        heap[currentSize].id = id;
+        pos[id] = currentSize;
+        currentSize++;
+        siftUp(currentSize - 1);
+    }
+
+    // Lower the priority of an item already in the heap
+    void decreaseKey(int id, const Key& key) {
+        if (!contains(id) || heap[pos[id]].key < key) {
+            Display::printError("IndexedHeap: decreaseKey on missing id or larger key");
+            return;
+        }
+        heap[pos[id]].key = key;
+        siftUp(pos[id]);
+    }
+
+    // insert() if absent, decreaseKey() if the new key is smaller.
+    // Returns true if the heap changed.
+    bool push(int id, const Key& key) {
+        if (!contains(id)) {
+            insert(id, key);
+            return contains(id);   // False if insert() rejected the id
+        }
+        if (key < heap[pos[id]].key) {
+            decreaseKey(id, key);
+            return true;
+        }
+        return false;
+    }
+
+    // Removes and returns the ID with the smallest key
+    int extractMin() {
+        if (currentSize == 0) {
+            throw out_of_range("IndexedHeap is empty");
+        }
+        int top = heap[0].id;
+        pos[top] = -1;
+        currentSize--;
+        if (currentSize > 0) {
+            place(0, heap[currentSize]);
+            siftDown(0);
+        }
+        return top;
+    }
+
+    // Drop an item wherever it is; returns false if it was not queued
+    bool remove(int id) {
+        if (!contains(id)) return false;
+        int i = pos[id];
+        pos[id] = -1;
+        currentSize--;
+        if (i < currentSize) {
+            // Fill the hole with the last entry, which may need to go either way
+            int moved = heap[currentSize].id;
+            place(i, heap[currentSize]);
+            siftUp(i);
+            siftDown(pos[moved]);
+        }
+        return true;
+    }
+
+    int minId() const {
+        if (currentSize == 0) {
+            throw out_of_range("IndexedHeap is empty");
+        }
+        return heap[0].id;
+    }
+
+    const Key& minKey() const {
+        minId();
+        return heap[0].key;
+    }
+
+    // Caller should check contains(id)
+    const Key& keyOf(int id) const {
+        return heap[pos[id]].key;
+    }
+
+    // Empty the heap in O(size), keeping the allocation
+    void clear() {
+        for (int i = 0; i < currentSize; i++) pos[heap[i].id] = -1;
+        currentSize = 0;
+    }
+
+    bool isEmpty() const {
+        return currentSize == 0;
+    }
+
+    int size() const {
+        return currentSize;
+    }
+
+    int capacity() const {
+        return maxItems;
+    }
+};
+
+#endif
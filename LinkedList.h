@@ -1,157 +1,236 @@
-#ifndef LINKEDLIST_H
-#define LINKEDLIST_H
-
-#include <iostream>
-#include "Display.h"
-
-using namespace std;
-
-template <typename T>
-struct Node {
-    T data;
-    Node* next;
-
-    Node(T val) : data(val), next(nullptr) {}
-};
-
-template <typename T>
-class LinkedList {
-private:
-    Node<T>* head;
-    int count;
-
-public:
-    LinkedList() : head(nullptr), count(0) {}
-
-    ~LinkedList() {
-        clear();
-    }
-
-    void insertHead(T val) {
-        Node<T>* newNode = new Node<T>(val);
-        newNode->next = head;
-        head = newNode;
-        count++;
-    }
-
-    void insertTail(T val) {
-        Node<T>* newNode = new Node<T>(val);
-        if (!head) {
-            head = newNode;
-        } else {
-            Node<T>* temp = head;
-            while (temp->next) {
-                temp = temp->next;
-            }
-            temp->next = newNode;
-        }
-        count++;
-    }
-
-    bool remove(T val) {
-        if (!head) return false;
-
-        if (head->data == val) {
-            Node<T>* temp = head;
-            head = head->next;
-            delete temp;
-            count--;
-            return true;
-        }
-
-        Node<T>* current = head;
-        while (current->next) {
-            if (current->next->data == val) {
-                Node<T>* temp = current->next;
-                current->next = temp->next;
-                delete temp;
-                count--;
-                return true;
-            }
-            current = current->next;
-        }
-        return false;
-    }
-
-    bool search(T val) const {
-        Node<T>* temp = head;
-        while (temp) {
-            if (temp->data == val) return true;
-            temp = temp->next;
-        }
-        return false;
-    }
-
-    void display() const {
-        if (!head) {
-            cout << "List is empty.\n";
-            return;
-        }
-        Node<T>* temp = head;
-        while (temp) {
-            cout << temp->data << " -> ";
-            temp = temp->next;
-        }
-        cout << "NULL\n";
-    }
-
-    void clear() {
-        Node<T>* temp = head;
-        while (temp) {
-            Node<T>* nextNode = temp->next;
-            delete temp;
-            temp = nextNode;
-        }
-        head = nullptr;
-        count = 0;
-    }
-
-    bool isEmpty() const {
-        return head == nullptr;
-    }
-
-    int size() const {
-        return count;
-    }
-
-    // Copy Constructor
-    LinkedList(const LinkedList& other) : head(nullptr), count(0) {
-        Node<T>* temp = other.head;
-        while (temp) {
-            insertTail(temp->data);
-            temp = temp->next;
-        }
-    }
-
-    // Assignment Operator
-    LinkedList& operator=(const LinkedList& other) {
-        if (this != &other) {
-            clear();
-            Node<T>* temp = other.head;
-            while (temp) {
-                insertTail(temp->data);
-                temp = temp->next;
-            }
-        }
-        return *this;
-    }
-
-    // Get data by index (0-based)
-    T get(int index) const {
-        if (index < 0 || index >= count) {
-            throw out_of_range("Index out of bounds");
-        }
-        Node<T>* temp = head;
-        for (int i = 0; i < index; i++) {
-            temp = temp->next;
-        }
-        return temp->data;
-    }
-
-    // Iterator-like access for traversal if needed
-    Node<T>* getHead() const {
-        return head;
-    }
-};
-
-#endif
+#ifndef LINKEDLIST_H
+#define LINKEDLIST_H
+
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include "Display.h"
+#include "NodePool.h"
+
+using namespace std;
+
+template <typename T>
+struct Node {
+    T data;
+    Node* next;
+
+    Node(const T& val) : data(val), next(nullptr) {}
+
+    Node(T&& val) : data(std::move(val)), next(nullptr) {}
+
+    // Build data in place from constructor arguments (emplace)
+    template <typename... Args>
+    Node(in_place_t, Args&&... args) : data(std::forward<Args>(args)...), next(nullptr) {}
+
+    // Nodes come from a per-type slab pool instead of the general heap
+    static void* operator new(size_t size) {
+        return NodePool<Node>::allocate(size);
+    }
+
+    static void operator delete(void* p, size_t size) {
+        NodePool<Node>::release(p, size);
+    }
+};
+
+template <typename T>
+class LinkedList {
+private:
+    Node<T>* head;
+    Node<T>* tail; // Last node, so insertTail is O(1)
+    int count;
+
+    T& linkHead(Node<T>* newNode) {
+        newNode->next = head;
+        head = newNode;
+        if (!tail) tail = newNode;
+        count++;
+        return newNode->data;
+    }
+
+    T& linkTail(Node<T>* newNode) {
+        if (!head) {
+            head = newNode;
+        } else {
+            tail->next = newNode;
+        }
+        tail = newNode;
+        count++;
+        return newNode->data;
+    }
+
+    Node<T>* nodeAt(int index) const {
+        if (index < 0 || index >= count) {
+            throw out_of_range("Index out of bounds");
+        }
+        Node<T>* temp = head;
+        for (int i = 0; i < index; i++) {
+            temp = temp->next;
+        }
+        return temp;
+    }
+
+public:
+    LinkedList() : head(nullptr), tail(nullptr), count(0) {}
+
+    ~LinkedList() {
+        clear();
+    }
+
+    void insertHead(const T& val) {
+        linkHead(new Node<T>(val));
+    }
+
+    void insertHead(T&& val) {
+        linkHead(new Node<T>(std::move(val)));
+    }
+
+    template <typename... Args>
+    T& emplaceHead(Args&&... args) {
+        return linkHead(new Node<T>(in_place, std::forward<Args>(args)...));
+    }
+
+    void insertTail(const T& val) {
+        linkTail(new Node<T>(val));
+    }
+
+    void insertTail(T&& val) {
+        linkTail(new Node<T>(std::move(val)));
+    }
+
+    template <typename... Args>
+    T& emplaceTail(Args&&... args) {
+        return linkTail(new Node<T>(in_place, std::forward<Args>(args)...));
+    }
+
+    bool remove(const T& val) {
+        if (!head) return false;
+
+        if (head->data == val) {
+            Node<T>* temp = head;
+            head = head->next;
+            if (temp == tail) tail = nullptr;
+            delete temp;
+            count--;
+            return true;
+        }
+
+        Node<T>* current = head;
+        while (current->next) {
+            if (current->next->data == val) {
+                Node<T>* temp = current->next;
+                current->next = temp->next;
+                if (temp == tail) tail = current;
+                delete temp;
+                count--;
+                return true;
+            }
+            current = current->next;
+        }
+        return false;
+    }
+
+    bool search(const T& val) const {
+        Node<T>* temp = head;
+        while (temp) {
+            if (temp->data == val) return true;
+            temp = temp->next;
+        }
+        return false;
+    }
+
+    void display() const {
+        if (!head) {
+            cout << "List is empty.\n";
+            return;
+        }
+        Node<T>* temp = head;
+        while (temp) {
+            cout << temp->data << " -> ";
+            temp = temp->next;
+        }
+        cout << "NULL\n";
+    }
+
+    void clear() {
+        Node<T>* temp = head;
+        while (temp) {
+            Node<T>* nextNode = temp->next;
+            delete temp;
+            temp = nextNode;
+        }
+        head = nullptr;
+        tail = nullptr;
+        count = 0;
+    }
+
+    bool isEmpty() const {
+        return head == nullptr;
+    }
+
+    int size() const {
+        return count;
+    }
+
+    // Copy Constructor
+    LinkedList(const LinkedList& other) : head(nullptr), tail(nullptr), count(0) {
+        Node<T>* temp = other.head;
+        while (temp) {
+            insertTail(temp->data);
+            temp = temp->next;
+        }
+    }
+
+    // Move Constructor - steals the nodes, no allocation
+    LinkedList(LinkedList&& other) noexcept : head(other.head), tail(other.tail), count(other.count) {
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.count = 0;
+    }
+
+    // Assignment Operator
+    LinkedList& operator=(const LinkedList& other) {
+        if (this != &other) {
+            clear();
+            Node<T>* temp = other.head;
+            while (temp) {
+                insertTail(temp->data);
+                temp = temp->next;
+            }
+        }
+        return *this;
+    }
+
+    // Move Assignment
+    LinkedList& operator=(LinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            head = other.head;
+            tail = other.tail;
+            count = other.count;
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.count = 0;
+        }
+        return *this;
+    }
+
+    // Get data by index (0-based)
+    T& get(int index) {
+        return nodeAt(index)->data;
+    }
+
+    const T& get(int index) const {
+        return nodeAt(index)->data;
+    }
+
+    // Iterator-like access for traversal if needed
+    Node<T>* getHead() {
+        return head;
+    }
+
+    const Node<T>* getHead() const {
+        return head;
+    }
+};
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef MPMCQUEUE_H
+#define MPMCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+using namespace std;
+
+// ============================================================================
+// MPMC QUEUE - Bounded lock-free multi-producer/multi-consumer queue
+// ============================================================================
+// Dmitry Vyukov's sequence-numbered ring. Every cell carries a sequence
+// number that tells producers and consumers whose turn it is:
+//   sequence == pos       -> cell is free for the producer claiming pos
+//   sequence == pos + 1   -> cell holds data for the consumer claiming pos
+// A thread claims a position with one CAS on enqueuePos/dequeuePos and then
+// owns the cell exclusively, so there are no locks and no ABA problem.
+// Capacity is fixed (rounded up to a power of two); tryEnqueue fails when
+// the ring is full instead of blocking.
+
+template <typename T>
+class MPMCQueue {
+private:
+    struct Cell {
+        atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() {
+            return reinterpret_cast<T*>(storage);
+        }
+    };
+
+    static constexpr size_t CACHE_LINE = 64;
+
+    Cell* cells;
+    size_t mask;
+
+    // Producer and consumer cursors on separate cache lines
+    alignas(CACHE_LINE) atomic<size_t> enqueuePos;
+    alignas(CACHE_LINE) atomic<size_t> dequeuePos;
+
+public:
+    explicit MPMCQueue(size_t capacity) : cells(nullptr), mask(0), enqueuePos(0), dequeuePos(0) {
+        size_t size = 2;
+        while (size < capacity) size *= 2;
+        cells = new Cell[size];
+        mask = size - 1;
+        for (size_t i = 0; i < size; i++) {
+            cells[i].sequence.store(i, memory_order_relaxed);
+        }
+    }
+
+    ~MPMCQueue() {
+        // Destroy anything still queued; no other thread may be using us now
+        size_t pos = dequeuePos.load(memory_order_relaxed);
+        size_t end = enqueuePos.load(memory_order_relaxed);
+        for (; pos != end; pos++) {
+            cells[pos & mask].value()->~T();
+        }
+        delete[] cells;
+    }
+
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    template <typename U>
+    bool tryEnqueue(U&& val) {
+        Cell* cell;
+        size_t pos = enqueuePos.load(memory_order_relaxed);
+        for (;;) {
+            cell = &cells[pos & mask];
+            size_t seq = cell->sequence.load(memory_order_acquire);
+            ptrdiff_t diff = (ptrdiff_t)seq - (ptrdiff_t)pos;
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false; // Full
+            } else {
+                pos = enqueuePos.load(memory_order_relaxed);
+            }
+        }
+        new (cell->storage) T(std::forward<U>(val));
+        cell->sequence.store(pos + 1, memory_order_release);
+        return true;
+    }
+
+    bool tryDequeue(T& out) {
+        Cell* cell;
+        size_t pos = dequeuePos.load(memory_order_relaxed);
+        for (;;) {
+            cell = &cells[pos & mask];
+            size_t seq = cell->sequence.load(memory_order_acquire);
+            ptrdiff_t diff = (ptrdiff_t)seq - (ptrdiff_t)(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false; // Empty
+            } else {
+                pos = dequeuePos.load(memory_order_relaxed);
+            }
+        }
+        T* p = cell->value();
+        out = std::move(*p);
+        p->~T();
+        // Free the cell for the producer one lap ahead
+        cell->sequence.store(pos + mask + 1, memory_order_release);
+        return true;
+    }
+
+    // Only exact when no other thread is enqueueing or dequeueing
+    size_t sizeApprox() const {
+        size_t enq = enqueuePos.load(memory_order_relaxed);
+        size_t deq = dequeuePos.load(memory_order_relaxed);
+        return enq > deq ? enq - deq : 0;
+    }
+
+    size_t capacity() const {
+        return mask + 1;
+    }
+};
+
+#endif
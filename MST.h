@@ -1,320 +1,445 @@
-#ifndef MST_H
-#define MST_H
-
-#include "Graph.h"
-#include "Heap.h"
-#include "Display.h"
-#include <string>
-
-using namespace std;
-
-// Forward declaration from Dijkstra.h
-extern string getSectorName(int id);
-extern string getSectorShort(int id);
-
-// Helper for Kruskal's Union-Find
-struct Subset {
-    int parent;
-    int rank;
-};
-
-// Helper for Kruskal's Edge sorting
-struct EdgeTriple {
-    int src;
-    int dest;
-    int weight;
-
-    EdgeTriple(int s, int d, int w) : src(s), dest(d), weight(w) {}
-    EdgeTriple() : src(0), dest(0), weight(0) {}
-
-    bool operator<(const EdgeTriple& other) const {
-        return weight < other.weight;
-    }
-    
-    bool operator>(const EdgeTriple& other) const {
-        return weight > other.weight;
-    }
-};
-
-class MST {
-private:
-    // Union-Find: Find with path compression
-    static int find(Subset subsets[], int i) {
-        if (subsets[i].parent != i)
-            subsets[i].parent = find(subsets, subsets[i].parent);
-        return subsets[i].parent;
-    }
-
-    // Union-Find: Union by rank
-    static void Union(Subset subsets[], int x, int y, bool verbose = false) {
-        int xroot = find(subsets, x);
-        int yroot = find(subsets, y);
-
-        if (verbose) {
-            Display::printSystemLog("UNION-FIND: Merging " + getSectorShort(x) + " (root: " + 
-                getSectorShort(xroot) + ") with " + getSectorShort(y) + " (root: " + getSectorShort(yroot) + ")");
-        }
-
-        if (subsets[xroot].rank < subsets[yroot].rank) {
-            subsets[xroot].parent = yroot;
-        } else if (subsets[xroot].rank > subsets[yroot].rank) {
-            subsets[yroot].parent = xroot;
-        } else {
-            subsets[yroot].parent = xroot;
-            subsets[xroot].rank++;
-        }
-    }
-
-public:
-    static void prims(Graph& g) {
-        int V = g.getNumVertices();
-        int* parent = new int[V];
-        int* key = new int[V];
-        bool* mstSet = new bool[V];
-
-        // ========== ALGORITHM EXPLANATION ==========
-        Display::printHeader("PRIM'S MST ALGORITHM - Optimal Delivery Network");
-        cout << "\n";
-        Display::setColor(Display::LIGHT_YELLOW);
-        cout << "=== DATA STRUCTURES USED ===\n";
-        Display::resetColor();
-        cout << "  1. GRAPH (Adjacency List) - Stores sector connections\n";
-        cout << "  2. ARRAYS (key[], parent[], mstSet[]) - Track minimum edges\n";
-        cout << "  3. MIN-HEAP (Priority Queue) - Always pick minimum weight edge\n";
-        cout << "\n";
-        Display::setColor(Display::LIGHT_YELLOW);
-        cout << "=== WHY PRIM'S MST? ===\n";
-        Display::resetColor();
-        cout << "  - Build optimal delivery network connecting ALL sectors\n";
-        cout << "  - Minimize total road distance for delivery coverage\n";
-        cout << "  - Ensures every sector is reachable with minimum cost\n";
-        cout << "\n";
-
-        Display::setColor(Display::LIGHT_CYAN);
-        cout << "=== STEP 1: INITIALIZATION ===\n";
-        Display::resetColor();
-        cout << "  Starting from " << getSectorName(0) << "\n";
-        cout << "  Setting all key values to INFINITY\n\n";
-
-        for (int i = 0; i < V; i++) {
-            key[i] = 2147483647;
-            mstSet[i] = false;
-            parent[i] = -1;
-        }
-
-        key[0] = 0;
-        parent[0] = -1;
-
-        struct KeyPair {
-            int v;
-            int key;
-            bool operator<(const KeyPair& o) const { return key < o.key; }
-            bool operator>(const KeyPair& o) const { return key > o.key; }
-        };
-
-        Heap<KeyPair> pq;
-        pq.insert({0, 0});
-        
-        Display::setColor(Display::LIGHT_CYAN);
-        cout << "=== STEP 2: BUILD MST (Greedy Selection) ===\n";
-        Display::resetColor();
-        Display::printSystemLog("HEAP OPERATION: Insert starting vertex");
-        cout << "\n";
-        
-        int step = 1;
-        int totalWeight = 0;
-
-        while (!pq.isEmpty()) {
-            Display::printSystemLog("HEAP OPERATION: ExtractMin() - Get minimum key vertex");
-            int u = pq.extractMin().v;
-            
-            if (mstSet[u]) {
-                cout << "  [Skip] " << getSectorShort(u) << " already in MST\n";
-                continue;
-            }
-            mstSet[u] = true;
-
-            Display::setColor(Display::LIGHT_GREEN);
-            cout << "\n  Step " << step++ << ": Adding " << getSectorName(u) << " to MST\n";
-            Display::resetColor();
-            
-            if (parent[u] != -1) {
-                cout << "    Edge: " << getSectorShort(parent[u]) << " -- " 
-                     << getSectorShort(u) << " (distance: " << key[u] << " km)\n";
-                totalWeight += key[u];
-            }
-
-            // Show current MST
-            cout << "    MST vertices: { ";
-            bool first = true;
-            for (int i = 0; i < V; i++) {
-                if (mstSet[i]) {
-                    if (!first) cout << ", ";
-                    cout << getSectorShort(i);
-                    first = false;
-                }
-            }
-            cout << " }\n";
-
-            Display::printSystemLog("GRAPH OPERATION: Traverse adjacency list of " + getSectorShort(u));
-            LinkedList<Edge>& adj = g.getAdjList(u);
-            Node<Edge>* temp = adj.getHead();
-            
-            cout << "    Checking roads from " << getSectorShort(u) << ":\n";
-            
-            while (temp) {
-                int v = temp->data.dest;
-                int weight = temp->data.weight;
-
-                cout << "      -> " << getSectorShort(v) << " (" << weight << " km): ";
-
-                if (mstSet[v]) {
-                    cout << "Already in MST\n";
-                } else if (weight < key[v]) {
-                    parent[v] = u;
-                    key[v] = weight;
-                    pq.insert({v, key[v]});
-                    Display::printSystemLog("HEAP OPERATION: Insert " + getSectorShort(v) + " with key " + to_string(weight));
-                    cout << "      Key updated to " << weight << " km\n";
-                } else {
-                    cout << "No improvement\n";
-                }
-                temp = temp->next;
-            }
-        }
-
-        // Display final MST
-        cout << "\n";
-        Display::setColor(Display::LIGHT_CYAN);
-        cout << "=== FINAL: OPTIMAL DELIVERY NETWORK ===\n";
-        Display::resetColor();
-        Display::printLine();
-        cout << "  Roads in network:\n";
-        for (int i = 1; i < V; i++) {
-            if (parent[i] != -1) {
-                cout << "    " << getSectorShort(parent[i]) << " <--> " << getSectorShort(i) 
-                     << " (" << key[i] << " km)\n";
-            }
-        }
-        Display::printLine();
-        Display::setColor(Display::LIGHT_GREEN);
-        cout << "  Total Network Distance: " << totalWeight << " km\n";
-        Display::resetColor();
-        cout << "  All " << V << " sectors are now connected with minimum total distance!\n";
-
-        delete[] parent;
-        delete[] key;
-        delete[] mstSet;
-    }
-
-    static void kruskals(Graph& g) {
-        int V = g.getNumVertices();
-        Heap<EdgeTriple> pq;
-
-        // ========== ALGORITHM EXPLANATION ==========
-        Display::printHeader("KRUSKAL'S MST ALGORITHM - Using Union-Find");
-        cout << "\n";
-        Display::setColor(Display::LIGHT_YELLOW);
-        cout << "=== DATA STRUCTURES USED ===\n";
-        Display::resetColor();
-        cout << "  1. GRAPH (Adjacency List) - Stores sector connections\n";
-        cout << "  2. MIN-HEAP - Sort edges by weight (greedy selection)\n";
-        cout << "  3. UNION-FIND (Disjoint Sets) - Detect cycles efficiently\n";
-        cout << "\n";
-        Display::setColor(Display::LIGHT_YELLOW);
-        cout << "=== WHY KRUSKAL'S MST? ===\n";
-        Display::resetColor();
-        cout << "  - Alternative way to build optimal delivery network\n";
-        cout << "  - Uses Union-Find to detect if edge creates a cycle\n";
-        cout << "  - Good for sparse graphs (few edges)\n";
-        cout << "\n";
-
-        Display::setColor(Display::LIGHT_CYAN);
-        cout << "=== STEP 1: COLLECT ALL EDGES ===\n";
-        Display::resetColor();
-        Display::printSystemLog("GRAPH OPERATION: Traverse all adjacency lists");
-        
-        int edgeCount = 0;
-        for (int i = 0; i < V; i++) {
-            LinkedList<Edge>& adj = g.getAdjList(i);
-            Node<Edge>* temp = adj.getHead();
-            while (temp) {
-                if (i < temp->data.dest) {
-                    pq.insert(EdgeTriple(i, temp->data.dest, temp->data.weight));
-                    cout << "    Edge: " << getSectorShort(i) << " -- " 
-                         << getSectorShort(temp->data.dest) << " (" << temp->data.weight << " km)\n";
-                    edgeCount++;
-                }
-                temp = temp->next;
-            }
-        }
-        cout << "  Total edges: " << edgeCount << "\n";
-        Display::printSystemLog("HEAP OPERATION: All edges inserted (sorted by weight)");
-        cout << "\n";
-
-        // Initialize Union-Find
-        Display::setColor(Display::LIGHT_CYAN);
-        cout << "=== STEP 2: INITIALIZE UNION-FIND ===\n";
-        Display::resetColor();
-        Display::printSystemLog("Creating disjoint sets - each sector is its own set");
-        Subset* subsets = new Subset[V];
-        for (int v = 0; v < V; ++v) {
-            subsets[v].parent = v;
-            subsets[v].rank = 0;
-        }
-        cout << "  Each sector starts as its own tree (self-parent)\n\n";
-
-        Display::setColor(Display::LIGHT_CYAN);
-        cout << "=== STEP 3: GREEDY EDGE SELECTION ===\n";
-        Display::resetColor();
-        cout << "  For each edge (smallest first), add if no cycle\n\n";
-        
-        int e = 0;
-        int step = 1;
-        int totalWeight = 0;
-        
-        while (e < V - 1 && !pq.isEmpty()) {
-            Display::printSystemLog("HEAP OPERATION: ExtractMin() - Get smallest edge");
-            EdgeTriple next_edge = pq.extractMin();
-            
-            cout << "  Step " << step++ << ": Edge " << getSectorShort(next_edge.src) 
-                 << " -- " << getSectorShort(next_edge.dest) << " (" << next_edge.weight << " km)\n";
-            
-            Display::printSystemLog("UNION-FIND: Find() - Get root of each vertex");
-            int x = find(subsets, next_edge.src);
-            int y = find(subsets, next_edge.dest);
-            
-            cout << "    Find(" << getSectorShort(next_edge.src) << ") = " << getSectorShort(x) << "\n";
-            cout << "    Find(" << getSectorShort(next_edge.dest) << ") = " << getSectorShort(y) << "\n";
-
-            if (x != y) {
-                Display::setColor(Display::LIGHT_GREEN);
-                cout << "    ACCEPTED - Different sets (no cycle)\n";
-                Display::resetColor();
-                
-                Union(subsets, x, y, true);
-                totalWeight += next_edge.weight;
-                e++;
-                cout << "    MST edges: " << e << "/" << (V-1) << "\n\n";
-            } else {
-                Display::setColor(Display::LIGHT_RED);
-                cout << "    REJECTED - Same set (would create cycle)\n\n";
-                Display::resetColor();
-            }
-        }
-
-        // Display final MST
-        Display::setColor(Display::LIGHT_CYAN);
-        cout << "=== FINAL: OPTIMAL DELIVERY NETWORK ===\n";
-        Display::resetColor();
-        Display::printLine();
-        Display::setColor(Display::LIGHT_GREEN);
-        cout << "  Total Network Distance: " << totalWeight << " km\n";
-        cout << "  Edges in MST: " << e << "\n";
-        Display::resetColor();
-
-        delete[] subsets;
-    }
-};
-
-#endif
+#ifndef MST_H
+#define MST_H
+
+#include "Graph.h"
+#include "Heap.h"
+#include "IndexedHeap.h"
+#include "DisjointSet.h"
+#include "Display.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Forward declaration from Dijkstra.h
+extern string getSectorName(int id);
+extern string getSectorShort(int id);
+
+// Helper for Kruskal's Edge sorting
+struct EdgeTriple {
+    int src;
+    int dest;
+    int weight;
+
+    EdgeTriple(int s, int d, int w) : src(s), dest(d), weight(w) {}
+    EdgeTriple() : src(0), dest(0), weight(0) {}
+
+    bool operator<(const EdgeTriple& other) const {
+        return weight < other.weight;
+    }
+    
+    bool operator>(const EdgeTriple& other) const {
+        return weight > other.weight;
+    }
+};
+
+// Minimum spanning forest returned by the quiet builders (one tree per
+// connected component, so edges.size() == V - components)
+struct MSTResult {
+    vector<EdgeTriple> edges;
+    long long totalWeight;
+
+    MSTResult() : totalWeight(0) {}
+};
+
+class MST {
+private:
+    // Lighter edge wins, ties go to the lower index, so every edge has a
+    // distinct key and one round of Boruvka can never close a cycle
+    static unsigned long long edgeKey(int weight, int index) {
+        unsigned long long w = (unsigned int)weight ^ 0x80000000u; // Keeps negative weights in order
+        return (w << 32) | (unsigned int)index;
+    }
+
+    static void keepMin(atomic<unsigned long long>& slot, unsigned long long key) {
+        unsigned long long current = slot.load(memory_order_relaxed);
+        while (key < current && !slot.compare_exchange_weak(current, key, memory_order_relaxed)) {
+        }
+    }
+
+    // Split [0, n) into one contiguous block per thread; body(first, last, t)
+    template <class Body>
+    static void parallelFor(int n, int threads, Body body) {
+        if (threads <= 1) {
+            body(0, n, 0);
+            return;
+        }
+        vector<thread> pool;
+        for (int t = 0; t < threads; t++) {
+            int first = (int)((long long)n * t / threads);
+            int last = (int)((long long)n * (t + 1) / threads);
+            pool.emplace_back(body, first, last, t);
+        }
+        for (size_t t = 0; t < pool.size(); t++) {
+            pool[t].join();
+        }
+    }
+
+public:
+    static void prims(Graph& g) {
+        prims(g.csr());
+    }
+
+    static void prims(const CSRGraph& g) {
+        int V = g.getNumVertices();
+        int* parent = new int[V];
+        int* key = new int[V];
+        bool* mstSet = new bool[V];
+
+        // ========== ALGORITHM EXPLANATION ==========
+        Display::printHeader("PRIM'S MST ALGORITHM - Optimal Delivery Network");
+        cout << "\n";
+        Display::setColor(Display::LIGHT_YELLOW);
+        cout << "=== DATA STRUCTURES USED ===\n";
+        Display::resetColor();
+        cout << "  1. GRAPH (CSR arrays built from the Adjacency List) - Stores sector connections\n";
+        cout << "  2. ARRAYS (key[], parent[], mstSet[]) - Track minimum edges\n";
+        cout << "  3. INDEXED MIN-HEAP (Priority Queue) - Always pick minimum weight edge,\n";
+        cout << "     using decrease-key instead of duplicate entries\n";
+        cout << "\n";
+        Display::setColor(Display::LIGHT_YELLOW);
+        cout << "=== WHY PRIM'S MST? ===\n";
+        Display::resetColor();
+        cout << "  - Build optimal delivery network connecting ALL sectors\n";
+        cout << "  - Minimize total road distance for delivery coverage\n";
+        cout << "  - Ensures every sector is reachable with minimum cost\n";
+        cout << "\n";
+
+        Display::setColor(Display::LIGHT_CYAN);
+        cout << "=== STEP 1: INITIALIZATION ===\n";
+        Display::resetColor();
+        cout << "  Starting from " << getSectorName(0) << "\n";
+        cout << "  Setting all key values to INFINITY\n\n";
+
+        for (int i = 0; i < V; i++) {
+            key[i] = 2147483647;
+            mstSet[i] = false;
+            parent[i] = -1;
+        }
+
+        key[0] = 0;
+        parent[0] = -1;
+
+        IndexedHeap<int> pq(V);
+        pq.insert(0, 0);
+        
+        Display::setColor(Display::LIGHT_CYAN);
+        cout << "=== STEP 2: BUILD MST (Greedy Selection) ===\n";
+        Display::resetColor();
+        Display::printSystemLog("HEAP OPERATION: Insert starting vertex");
+        cout << "\n";
+        
+        int step = 1;
+        int totalWeight = 0;
+
+        while (!pq.isEmpty()) {
+            Display::printSystemLog("HEAP OPERATION: ExtractMin() - Get minimum key vertex");
+            int u = pq.extractMin();
+            mstSet[u] = true;
+
+            Display::setColor(Display::LIGHT_GREEN);
+            cout << "\n  Step " << step++ << ": Adding " << getSectorName(u) << " to MST\n";
+            Display::resetColor();
+            
+            if (parent[u] != -1) {
+                cout << "    Edge: " << getSectorShort(parent[u]) << " -- " 
+                     << getSectorShort(u) << " (distance: " << key[u] << " km)\n";
+                totalWeight += key[u];
+            }
+
+            // Show current MST
+            cout << "    MST vertices: { ";
+            bool first = true;
+            for (int i = 0; i < V; i++) {
+                if (mstSet[i]) {
+                    if (!first) cout << ", ";
+                    cout << getSectorShort(i);
+                    first = false;
+                }
+            }
+            cout << " }\n";
+
+            Display::printSystemLog("GRAPH OPERATION: Scan CSR arcs of " + getSectorShort(u));
+            
+            cout << "    Checking roads from " << getSectorShort(u) << ":\n";
+            
+            for (int e = g.arcBegin(u); e < g.arcEnd(u); e++) {
+                int v = g.arcDest(e);
+                int weight = g.arcWeight(e);
+
+                cout << "      -> " << getSectorShort(v) << " (" << weight << " km): ";
+
+                if (mstSet[v]) {
+                    cout << "Already in MST\n";
+                } else if (weight < key[v]) {
+                    parent[v] = u;
+                    key[v] = weight;
+                    bool queued = pq.contains(v);
+                    pq.push(v, key[v]);
+                    Display::printSystemLog(string("HEAP OPERATION: ") + (queued ? "DecreaseKey " : "Insert ")
+                                            + getSectorShort(v) + " with key " + to_string(weight));
+                    cout << "      Key updated to " << weight << " km\n";
+                } else {
+                    cout << "No improvement\n";
+                }
+            }
+        }
+
+        // Display final MST
+        cout << "\n";
+        Display::setColor(Display::LIGHT_CYAN);
+        cout << "=== FINAL: OPTIMAL DELIVERY NETWORK ===\n";
+        Display::resetColor();
+        Display::printLine();
+        cout << "  Roads in network:\n";
+        for (int i = 1; i < V; i++) {
+            if (parent[i] != -1) {
+                cout << "    " << getSectorShort(parent[i]) << " <--> " << getSectorShort(i) 
+                     << " (" << key[i] << " km)\n";
+            }
+        }
+        Display::printLine();
+        Display::setColor(Display::LIGHT_GREEN);
+        cout << "  Total Network Distance: " << totalWeight << " km\n";
+        Display::resetColor();
+        cout << "  All " << V << " sectors are now connected with minimum total distance!\n";
+
+        delete[] parent;
+        delete[] key;
+        delete[] mstSet;
+    }
+
+    static void kruskals(Graph& g) {
+        kruskals(g.csr());
+    }
+
+    static void kruskals(const CSRGraph& g) {
+        int V = g.getNumVertices();
+        Heap<EdgeTriple, 4> pq;
+
+        // ========== ALGORITHM EXPLANATION ==========
+        Display::printHeader("KRUSKAL'S MST ALGORITHM - Using Union-Find");
+        cout << "\n";
+        Display::setColor(Display::LIGHT_YELLOW);
+        cout << "=== DATA STRUCTURES USED ===\n";
+        Display::resetColor();
+        cout << "  1. GRAPH (CSR arrays built from the Adjacency List) - Stores sector connections\n";
+        cout << "  2. MIN-HEAP - Sort edges by weight (greedy selection)\n";
+        cout << "  3. UNION-FIND (Disjoint Sets) - Detect cycles efficiently\n";
+        cout << "\n";
+        Display::setColor(Display::LIGHT_YELLOW);
+        cout << "=== WHY KRUSKAL'S MST? ===\n";
+        Display::resetColor();
+        cout << "  - Alternative way to build optimal delivery network\n";
+        cout << "  - Uses Union-Find to detect if edge creates a cycle\n";
+        cout << "  - Good for sparse graphs (few edges)\n";
+        cout << "\n";
+
+        Display::setColor(Display::LIGHT_CYAN);
+        cout << "=== STEP 1: COLLECT ALL EDGES ===\n";
+        Display::resetColor();
+        Display::printSystemLog("GRAPH OPERATION: Scan all CSR arcs");
+        
+        int edgeCount = 0;
+        for (int i = 0; i < V; i++) {
+            for (int e = g.arcBegin(i); e < g.arcEnd(i); e++) {
+                int d = g.arcDest(e);
+                // Undirected edges are stored both ways; take each once
+                if (g.isDirected() || i < d) {
+                    pq.insert(EdgeTriple(i, d, g.arcWeight(e)));
+                    cout << "    Edge: " << getSectorShort(i) << " -- " 
+                         << getSectorShort(d) << " (" << g.arcWeight(e) << " km)\n";
+                    edgeCount++;
+                }
+            }
+        }
+        cout << "  Total edges: " << edgeCount << "\n";
+        Display::printSystemLog("HEAP OPERATION: All edges inserted (sorted by weight)");
+        cout << "\n";
+
+        // Initialize Union-Find
+        Display::setColor(Display::LIGHT_CYAN);
+        cout << "=== STEP 2: INITIALIZE UNION-FIND ===\n";
+        Display::resetColor();
+        Display::printSystemLog("Creating disjoint sets - each sector is its own set");
+        DisjointSet sets(V);
+        cout << "  Each sector starts as its own tree (self-parent)\n\n";
+
+        Display::setColor(Display::LIGHT_CYAN);
+        cout << "=== STEP 3: GREEDY EDGE SELECTION ===\n";
+        Display::resetColor();
+        cout << "  For each edge (smallest first), add if no cycle\n\n";
+        
+        int e = 0;
+        int step = 1;
+        int totalWeight = 0;
+        
+        while (e < V - 1 && !pq.isEmpty()) {
+            Display::printSystemLog("HEAP OPERATION: ExtractMin() - Get smallest edge");
+            EdgeTriple next_edge = pq.extractMin();
+            
+            cout << "  Step " << step++ << ": Edge " << getSectorShort(next_edge.src) 
+                 << " -- " << getSectorShort(next_edge.dest) << " (" << next_edge.weight << " km)\n";
+            
+            Display::printSystemLog("UNION-FIND: Find() - Get root of each vertex");
+            int x = sets.find(next_edge.src);
+            int y = sets.find(next_edge.dest);
+            
+            cout << "    Find(" << getSectorShort(next_edge.src) << ") = " << getSectorShort(x) << "\n";
+            cout << "    Find(" << getSectorShort(next_edge.dest) << ") = " << getSectorShort(y) << "\n";
+
+            if (x != y) {
+                Display::setColor(Display::LIGHT_GREEN);
+                cout << "    ACCEPTED - Different sets (no cycle)\n";
+                Display::resetColor();
+                
+                Display::printSystemLog("UNION-FIND: Merging " + getSectorShort(x) + " (set of "
+                    + to_string(sets.setSize(x)) + ") with " + getSectorShort(y) + " (set of "
+                    + to_string(sets.setSize(y)) + ")");
+                sets.unite(x, y);
+                totalWeight += next_edge.weight;
+                e++;
+                cout << "    MST edges: " << e << "/" << (V-1) << "\n\n";
+            } else {
+                Display::setColor(Display::LIGHT_RED);
+                cout << "    REJECTED - Same set (would create cycle)\n\n";
+                Display::resetColor();
+            }
+        }
+
+        // Display final MST
+        Display::setColor(Display::LIGHT_CYAN);
+        cout << "=== FINAL: OPTIMAL DELIVERY NETWORK ===\n";
+        Display::resetColor();
+        Display::printLine();
+        Display::setColor(Display::LIGHT_GREEN);
+        cout << "  Total Network Distance: " << totalWeight << " km\n";
+        cout << "  Edges in MST: " << e << "\n";
+        Display::resetColor();
+    }
+
+    static MSTResult boruvka(Graph& g, int threads = 0) {
+        return boruvka(g.csr(), threads);
+    }
+
+    // Parallel Boruvka: no output, result returned as a value. Each round,
+    // every component picks its lightest edge to another component and all
+    // picked edges are merged at once through a ConcurrentDisjointSet, so
+    // there are at most log2(V) rounds.
+    // Edges that end up inside one component are dropped as the round scans
+    // them, so later rounds only look at the few roads still between zones.
+    // Every phase is split across threads by vertex or edge range.
+    // threads = 0 picks one per core; small graphs stay on this thread.
+    // Directed arcs are treated as undirected roads.
+    static MSTResult boruvka(const CSRGraph& g, int threads = 0) {
+        int V = g.getNumVertices();
+        MSTResult result;
+        if (V == 0) return result;
+
+        if (threads <= 0) threads = (int)thread::hardware_concurrency();
+        if (threads < 1) threads = 1;
+        if (threads > V / 4096) threads = V / 4096 > 0 ? V / 4096 : 1;
+
+        const unsigned long long NONE = ~0ULL;
+        ConcurrentDisjointSet sets(V);
+        atomic<unsigned long long>* best = new atomic<unsigned long long>[V];
+        int* label = new int[V];
+        bool directed = g.isDirected();
+
+        // Edges still between two components, each once (u < w when undirected)
+        struct Candidate {
+            int u, w, weight;
+        };
+        vector<vector<Candidate> > parts(threads);
+        parallelFor(V, threads, [&](int first, int last, int t) {
+            for (int u = first; u < last; u++) {
+                for (int e = g.arcBegin(u); e < g.arcEnd(u); e++) {
+                    int w = g.arcDest(e);
+                    if (w == u || (!directed && w < u)) continue;
+                    Candidate c = {u, w, g.arcWeight(e)};
+                    parts[t].push_back(c);
+                }
+            }
+        });
+        size_t total = 0;
+        for (int t = 0; t < threads; t++) total += parts[t].size();
+        vector<Candidate> edges;
+        edges.reserve(total);
+        for (int t = 0; t < threads; t++) {
+            edges.insert(edges.end(), parts[t].begin(), parts[t].end());
+            vector<Candidate>().swap(parts[t]);
+        }
+
+        vector<size_t> kept(threads);
+        vector<vector<EdgeTriple> > picked(threads);
+
+        while (!edges.empty()) {
+            // 1. Snapshot each vertex's component and clear the choices
+            parallelFor(V, threads, [&](int first, int last, int) {
+                for (int v = first; v < last; v++) {
+                    label[v] = sets.find(v);
+                    best[v].store(NONE, memory_order_relaxed);
+                }
+            });
+
+            // 2. Lightest edge leaving each component. Internal edges are
+            // squeezed out of each thread's block on the way; keys use the
+            // edge's new slot, which stays put until step 4.
+            int m = (int)edges.size();
+            parallelFor(m, threads, [&](int first, int last, int t) {
+                int out = first;
+                for (int i = first; i < last; i++) {
+                    Candidate c = edges[i];
+                    int cu = label[c.u];
+                    int cw = label[c.w];
+                    if (cu == cw) continue;
+                    unsigned long long key = edgeKey(c.weight, out);
+                    keepMin(best[cu], key);
+                    keepMin(best[cw], key);
+                    edges[out++] = c;
+                }
+                kept[t] = out - first;
+            });
+
+            // 3. Merge along the chosen edges. Two components that chose the
+            // same edge merge only once, so each edge is recorded once.
+            parallelFor(V, threads, [&](int first, int last, int t) {
+                for (int c = first; c < last; c++) {
+                    unsigned long long key = best[c].load(memory_order_relaxed);
+                    if (label[c] != c || key == NONE) continue;
+                    const Candidate& e = edges[key & 0xffffffffULL];
+                    if (sets.unite(e.u, e.w)) {
+                        picked[t].push_back(EdgeTriple(e.u, e.w, e.weight));
+                    }
+                }
+            });
+
+            // 4. Close the gaps between the threads' blocks
+            size_t end = 0;
+            for (int t = 0; t < threads; t++) {
+                size_t first = (size_t)((long long)m * t / threads);
+                if (first != end) {
+                    for (size_t i = 0; i < kept[t]; i++) edges[end + i] = edges[first + i];
+                }
+                end += kept[t];
+            }
+            edges.resize(end);
+
+            for (int t = 0; t < threads; t++) {
+                for (size_t i = 0; i < picked[t].size(); i++) {
+                    result.edges.push_back(picked[t][i]);
+                    result.totalWeight += picked[t][i].weight;
+                }
+                picked[t].clear();
+            }
+        }
+
+        delete[] best;
+        delete[] label;
+        return result;
+    }
+};
+
+#endif
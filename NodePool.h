@@ -0,0 +1,186 @@
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <cstddef>
+#include <new>
+#include <mutex>
+#include <vector>
+#include <utility>
+
+using namespace std;
+
+// ============================================================================
+// NODE POOL - Slab allocator for fixed-size list/tree nodes
+// ============================================================================
+// Nodes are carved out of large slabs with a pointer bump, and freed nodes go
+// onto a free list that the next allocation pops. Both steps are O(1) and
+// avoid a trip to the general-purpose heap for every insert.
+//
+// The pool is per node type and per thread (thread_local), so the fast path
+// takes no lock. Nodes freed on a different thread than the one that made
+// them (producer/consumer hand-offs) pile up on the consumer's free list, so
+// once a thread holds more than two batches of free nodes it hands one batch
+// to a shared depot, and a thread with an empty free list takes a batch from
+// the depot before carving a new slab. A depot trip is one mutex per
+// BATCH nodes. Slabs are kept for the lifetime of the process and reused.
+//
+// Build flags:
+//   NODEPOOL_DISABLE - fall back to plain new/delete (useful with ASan or
+//                      valgrind to catch use-after-free on nodes).
+
+template <typename NodeT>
+class NodePool {
+private:
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    // Every slot must be able to hold a free-list link
+    static constexpr size_t SLOT_SIZE = sizeof(NodeT) > sizeof(FreeSlot) ? sizeof(NodeT) : sizeof(FreeSlot);
+    static constexpr size_t SLOT_ALIGN = alignof(NodeT) > alignof(FreeSlot) ? alignof(NodeT) : alignof(FreeSlot);
+    static constexpr size_t SLOT_STRIDE = (SLOT_SIZE + SLOT_ALIGN - 1) / SLOT_ALIGN * SLOT_ALIGN;
+
+    static constexpr size_t FIRST_SLAB_SLOTS = 64;
+    static constexpr size_t MAX_SLAB_SLOTS = 65536;
+    static constexpr size_t BATCH = 256;
+
+    // Free-node batches shared between threads
+    struct Depot {
+        mutex lock;
+        vector<pair<FreeSlot*, size_t>> batches; // Chain head and length
+    };
+
+    static Depot& depot() {
+        static Depot* d = new Depot(); // Never destroyed: threads may outlive statics
+        return *d;
+    }
+
+    struct State {
+        FreeSlot* freeList;
+        size_t freeCount;
+        char* bump;
+        char* bumpEnd;
+        size_t nextSlabSlots;
+
+        State() : freeList(nullptr), freeCount(0), bump(nullptr), bumpEnd(nullptr), nextSlabSlots(FIRST_SLAB_SLOTS) {}
+
+        // Give the free list back when the thread exits. The main thread's
+        // State dies before global objects, whose nodes may still be freed
+        // afterwards; stateDead() routes those around the dead State.
+        ~State() {
+            if (freeList) {
+                Depot& d = depot();
+                lock_guard<mutex> guard(d.lock);
+                d.batches.push_back(make_pair(freeList, freeCount));
+            }
+            freeList = nullptr;
+            freeCount = 0;
+            stateDead() = true;
+        }
+    };
+
+    // Trivially destructible, so still readable after State is gone
+    static bool& stateDead() {
+        thread_local bool dead = false;
+        return dead;
+    }
+
+    // A node freed after this thread's State died goes straight to the depot
+    static void giveOne(FreeSlot* slot) {
+        slot->next = nullptr;
+        Depot& d = depot();
+        lock_guard<mutex> guard(d.lock);
+        d.batches.push_back(make_pair(slot, (size_t)1));
+    }
+
+    static bool takeBatch(State& s) {
+        Depot& d = depot();
+        lock_guard<mutex> guard(d.lock);
+        if (d.batches.empty()) return false;
+        s.freeList = d.batches.back().first;
+        s.freeCount = d.batches.back().second;
+        d.batches.pop_back();
+        return true;
+    }
+
+    static void giveBatch(State& s) {
+        FreeSlot* batch = s.freeList;
+        FreeSlot* last = batch;
+        for (size_t i = 1; i < BATCH; i++) last = last->next;
+        s.freeList = last->next;
+        s.freeCount -= BATCH;
+        last->next = nullptr;
+
+        Depot& d = depot();
+        lock_guard<mutex> guard(d.lock);
+        d.batches.push_back(make_pair(batch, BATCH));
+    }
+
+    static State& state() {
+        thread_local State s;
+        return s;
+    }
+
+    static void* refill(State& s) {
+        // Slabs double in size up to MAX_SLAB_SLOTS
+        size_t slots = s.nextSlabSlots;
+        if (s.nextSlabSlots < MAX_SLAB_SLOTS) s.nextSlabSlots *= 2;
+
+        char* slab = static_cast<char*>(::operator new(slots * SLOT_STRIDE + SLOT_ALIGN));
+        size_t misalign = reinterpret_cast<size_t>(slab) % SLOT_ALIGN;
+        if (misalign) slab += SLOT_ALIGN - misalign;
+
+        s.bump = slab + SLOT_STRIDE;
+        s.bumpEnd = slab + slots * SLOT_STRIDE;
+        return slab;
+    }
+
+public:
+    static void* allocate(size_t size) {
+#ifndef NODEPOOL_DISABLE
+        if (size == sizeof(NodeT)) {
+            if (stateDead()) return ::operator new(SLOT_SIZE);
+            State& s = state();
+            if (s.bump == s.bumpEnd && !s.freeList) {
+                // Prefer nodes other threads handed back over a new slab
+                if (!takeBatch(s)) return refill(s);
+            }
+            if (s.freeList) {
+                FreeSlot* slot = s.freeList;
+                s.freeList = slot->next;
+                s.freeCount--;
+                return slot;
+            }
+            void* p = s.bump;
+            s.bump += SLOT_STRIDE;
+            return p;
+        }
+#endif
+        return ::operator new(size);
+    }
+
+    static void release(void* p, size_t size) {
+        if (!p) return;
+#ifndef NODEPOOL_DISABLE
+        if (size == sizeof(NodeT)) {
+            FreeSlot* slot = static_cast<FreeSlot*>(p);
+            if (stateDead()) {
+                // Pool slots are not individually allocated, so they can't
+                // go to ::operator delete
+                giveOne(slot);
+                return;
+            }
+            State& s = state();
+            slot->next = s.freeList;
+            s.freeList = slot;
+            if (++s.freeCount > 2 * BATCH) giveBatch(s);
+            return;
+        }
+#else
+        (void)size;
+#endif
+        ::operator delete(p);
+    }
+};
+
+#endif
@@ -1,47 +1,125 @@
-#ifndef ORDERMANAGER_H
-#define ORDERMANAGER_H
-
-#include "Order.h"
-#include "Queue.h"
-#include "Display.h"
-
-using namespace std;
-
-class OrderManager {
-private:
-    Queue<Order> activeOrders;
-    LinkedList<Order> allOrders; // For history/analytics
-
-public:
-    void placeOrder(Order order) {
-        Display::printSystemLog("Using Queue::enqueue() to add order to active list...");
-        activeOrders.enqueue(order);
-        Display::printSystemLog("Using LinkedList::insertTail() to log order history...");
-        allOrders.insertTail(order);
-        Display::printSuccess("Order Placed Successfully! ID: " + order.orderID);
-    }
-
-    Order getNextOrder() {
-        if (!activeOrders.isEmpty()) {
-            Display::printSystemLog("Dequeuing Order from Active Queue...");
-            Order o = activeOrders.front();
-            activeOrders.dequeue();
-            return o;
-        }
-        return Order();
-    }
-
-    void displayActiveOrders() {
-        Display::printHeader("Active Orders");
-        // Queue doesn't support traversal easily without dequeuing.
-        // For display, we might need a different structure or just peek front.
-        if (activeOrders.isEmpty()) {
-            cout << "No active orders.\n";
-        } else {
-            cout << "Next Order: " << activeOrders.front() << "\n";
-            cout << "(Total Active: " << activeOrders.size() << ")\n";
-        }
-    }
-};
-
-#endif
+#ifndef ORDERMANAGER_H
+#define ORDERMANAGER_H
+
+#include "Order.h"
+#include "Queue.h"
+#include "MPMCQueue.h"
+#include "Display.h"
+#include <atomic>
+
+using namespace std;
+
+// Two backends for the active order queue:
+//   OrderManager om;          - single-threaded Queue<Order> (the default)
+//   OrderManager om(65536);   - lock-free MPMCQueue with that capacity, so
+//                               many threads may call placeOrder() and
+//                               getNextOrder()/tryGetNextOrder() at once
+class OrderManager {
+private:
+    // Lock-free push-only history list used by the concurrent backend
+    struct HistoryNode {
+        Order order;
+        HistoryNode* next;
+
+        HistoryNode(Order&& o) : order(std::move(o)), next(nullptr) {}
+    };
+
+    Queue<Order> activeOrders;
+    LinkedList<Order> allOrders; // For history/analytics
+
+    MPMCQueue<Order>* concurrentOrders; // nullptr in single-threaded mode
+    atomic<HistoryNode*> concurrentHistory;
+    atomic<int> concurrentCount;
+
+    void logConcurrent(Order&& order) {
+        HistoryNode* node = new HistoryNode(std::move(order));
+        node->next = concurrentHistory.load(memory_order_relaxed);
+        while (!concurrentHistory.compare_exchange_weak(node->next, node,
+                                                        memory_order_release, memory_order_relaxed)) {
+        }
+        concurrentCount.fetch_add(1, memory_order_relaxed);
+    }
+
+public:
+    OrderManager() : concurrentOrders(nullptr), concurrentHistory(nullptr), concurrentCount(0) {}
+
+    explicit OrderManager(int concurrentCapacity)
+        : concurrentOrders(new MPMCQueue<Order>(concurrentCapacity)), concurrentHistory(nullptr), concurrentCount(0) {}
+
+    ~OrderManager() {
+        delete concurrentOrders;
+        HistoryNode* node = concurrentHistory.load();
+        while (node) {
+            HistoryNode* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    OrderManager(const OrderManager&) = delete;
+    OrderManager& operator=(const OrderManager&) = delete;
+
+    bool isConcurrent() const {
+        return concurrentOrders != nullptr;
+    }
+
+    // Returns false only when the concurrent queue is full
+    bool placeOrder(Order order) {
+        if (concurrentOrders) {
+            if (!concurrentOrders->tryEnqueue(order)) {
+                Display::printError("Order queue full, try again: " + order.orderID);
+                return false;
+            }
+            logConcurrent(std::move(order));
+            return true;
+        }
+
+        DISPLAY_SYSTEM_LOG("Using Queue::enqueue() to add order to active list...");
+        activeOrders.enqueue(order);
+        DISPLAY_SYSTEM_LOG("Using LinkedList::insertTail() to log order history...");
+        Order& logged = allOrders.emplaceTail(std::move(order));
+        Display::printSuccess("Order Placed Successfully! ID: " + logged.orderID);
+        return true;
+    }
+
+    // Moves the next order into out; false if there is none
+    bool tryGetNextOrder(Order& out) {
+        if (concurrentOrders) {
+            return concurrentOrders->tryDequeue(out);
+        }
+        if (activeOrders.isEmpty()) return false;
+        DISPLAY_SYSTEM_LOG("Dequeuing Order from Active Queue...");
+        return activeOrders.dequeue(out);
+    }
+
+    Order getNextOrder() {
+        Order o;
+        tryGetNextOrder(o);
+        return o;
+    }
+
+    int activeCount() const {
+        return concurrentOrders ? (int)concurrentOrders->sizeApprox() : activeOrders.size();
+    }
+
+    int totalOrders() const {
+        return concurrentOrders ? concurrentCount.load(memory_order_relaxed) : allOrders.size();
+    }
+
+    void displayActiveOrders() {
+        Display::printHeader("Active Orders");
+        if (activeCount() == 0) {
+            cout << "No active orders.\n";
+        } else if (concurrentOrders) {
+            // The lock-free queue can't be peeked safely
+            cout << "(Total Active: ~" << activeCount() << ")\n";
+        } else {
+            // Queue doesn't support traversal easily without dequeuing.
+            // For display, we might need a different structure or just peek front.
+            cout << "Next Order: " << activeOrders.front() << "\n";
+            cout << "(Total Active: " << activeOrders.size() << ")\n";
+        }
+    }
+};
+
+#endif
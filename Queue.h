@@ -1,63 +1,182 @@
-#ifndef QUEUE_H
-#define QUEUE_H
-
-#include "LinkedList.h"
-
-template <typename T>
-class Queue {
-private:
-    Node<T>* frontNode;
-    Node<T>* rearNode;
-    int count;
-
-public:
-    Queue() : frontNode(nullptr), rearNode(nullptr), count(0) {}
-
-    ~Queue() {
-        while (!isEmpty()) {
-            dequeue();
-        }
-    }
-
-    void enqueue(T val) {
-        Node<T>* newNode = new Node<T>(val);
-        if (isEmpty()) {
-            frontNode = rearNode = newNode;
-        } else {
-            rearNode->next = newNode;
-            rearNode = newNode;
-        }
-        count++;
-    }
-
-    void dequeue() {
-        if (isEmpty()) {
-            Display::printError("Queue Underflow");
-            return;
-        }
-        Node<T>* temp = frontNode;
-        frontNode = frontNode->next;
-        if (frontNode == nullptr) {
-            rearNode = nullptr;
-        }
-        delete temp;
-        count--;
-    }
-
-    T front() const {
-        if (isEmpty()) {
-            return T(); // Caller should check isEmpty
-        }
-        return frontNode->data;
-    }
-
-    bool isEmpty() const {
-        return frontNode == nullptr;
-    }
-
-    int size() const {
-        return count;
-    }
-};
-
-#endif
+#ifndef QUEUE_H
+#define QUEUE_H
+
+#include "LinkedList.h"
+#include <new>
+
+// ============================================================================
+// QUEUE - Growable ring buffer (FIFO)
+// ============================================================================
+// Elements sit in one contiguous power-of-two array; head indexes the front
+// and (head + count) & mask is the next free slot. Enqueue/dequeue are O(1)
+// with no per-element allocation; the buffer doubles when full.
+
+template <typename T>
+class Queue {
+private:
+    T* buffer;       // Raw storage, only [head, head + count) is constructed
+    int capacity;    // 0 or a power of two
+    int head;
+    int count;
+
+    int slot(int i) const {
+        return (head + i) & (capacity - 1);
+    }
+
+    void grow(int minCapacity) {
+        int newCapacity = capacity ? capacity : 8;
+        while (newCapacity < minCapacity) newCapacity *= 2;
+        if (newCapacity == capacity) return;
+
+        T* newBuffer = static_cast<T*>(::operator new(sizeof(T) * newCapacity));
+        for (int i = 0; i < count; i++) {
+            T& src = buffer[slot(i)];
+            new (&newBuffer[i]) T(std::move(src));
+            src.~T();
+        }
+        ::operator delete(buffer);
+        buffer = newBuffer;
+        capacity = newCapacity;
+        head = 0;
+    }
+
+    // Construct the new rear element. When the buffer is full the element
+    // is built before grow(), since the arguments may refer to an element
+    // of this queue (q.enqueue(q.front())) that grow() moves away.
+    template <typename... Args>
+    T& construct(Args&&... args) {
+        T* p;
+        if (count == capacity) {
+            T val(std::forward<Args>(args)...);
+            grow(count + 1);
+            p = new (&buffer[slot(count)]) T(std::move(val));
+        } else {
+            p = new (&buffer[slot(count)]) T(std::forward<Args>(args)...);
+        }
+        count++;
+        return *p;
+    }
+
+public:
+    Queue() : buffer(nullptr), capacity(0), head(0), count(0) {}
+
+    ~Queue() {
+        clear();
+        ::operator delete(buffer);
+    }
+
+    // Copy Constructor - deep copy, front to rear
+    Queue(const Queue& other) : buffer(nullptr), capacity(0), head(0), count(0) {
+        reserve(other.count);
+        for (int i = 0; i < other.count; i++) {
+            enqueue(other.buffer[other.slot(i)]);
+        }
+    }
+
+    // Move Constructor - steals the buffer
+    Queue(Queue&& other) noexcept
+        : buffer(other.buffer), capacity(other.capacity), head(other.head), count(other.count) {
+        other.buffer = nullptr;
+        other.capacity = other.head = other.count = 0;
+    }
+
+    Queue& operator=(Queue other) noexcept {
+        swap(buffer, other.buffer);
+        swap(capacity, other.capacity);
+        swap(head, other.head);
+        swap(count, other.count);
+        return *this;
+    }
+
+    // Make room for n elements without further reallocation
+    void reserve(int n) {
+        if (n > capacity) grow(n);
+    }
+
+    void enqueue(const T& val) {
+        construct(val);
+    }
+
+    void enqueue(T&& val) {
+        construct(std::move(val));
+    }
+
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        return construct(std::forward<Args>(args)...);
+    }
+
+    // Append n elements with at most one reallocation
+    void enqueueBatch(const T items[], int n) {
+        reserve(count + n);
+        for (int i = 0; i < n; i++) {
+            new (&buffer[slot(count)]) T(items[i]);
+            count++;
+        }
+    }
+
+    void dequeue() {
+        if (isEmpty()) {
+            Display::printError("Queue Underflow");
+            return;
+        }
+        buffer[head].~T();
+        head = (head + 1) & (capacity - 1);
+        count--;
+    }
+
+    // Move the front element into out and remove it
+    bool dequeue(T& out) {
+        if (isEmpty()) return false;
+        out = std::move(buffer[head]);
+        dequeue();
+        return true;
+    }
+
+    // Move up to n front elements into out[0..]; returns how many were taken
+    int dequeueBatch(int n, T out[]) {
+        if (n < 0) n = 0;
+        int taken = n < count ? n : count;
+        for (int i = 0; i < taken; i++) {
+            T& src = buffer[head];
+            out[i] = std::move(src);
+            src.~T();
+            head = (head + 1) & (capacity - 1);
+        }
+        count -= taken;
+        return taken;
+    }
+
+    // Caller should check isEmpty
+    T& front() {
+        if (isEmpty()) {
+            throw out_of_range("Queue is empty");
+        }
+        return buffer[head];
+    }
+
+    const T& front() const {
+        if (isEmpty()) {
+            throw out_of_range("Queue is empty");
+        }
+        return buffer[head];
+    }
+
+    void clear() {
+        for (int i = 0; i < count; i++) {
+            buffer[slot(i)].~T();
+        }
+        head = 0;
+        count = 0;
+    }
+
+    bool isEmpty() const {
+        return count == 0;
+    }
+
+    int size() const {
+        return count;
+    }
+};
+
+#endif
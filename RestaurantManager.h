@@ -1,62 +1,95 @@
-#ifndef RESTAURANTMANAGER_H
-#define RESTAURANTMANAGER_H
-
-#include "Restaurant.h"
-#include "LinkedList.h"
-#include "Display.h"
-
-using namespace std;
-
-class RestaurantManager {
-private:
-    LinkedList<Restaurant> restaurants;
-
-public:
-    void addRestaurant(string id, string name, string cat, double rating) {
-        Restaurant r(id, name, cat, rating);
-        restaurants.insertTail(r);
-        Display::printSystemLog("Added Restaurant to LinkedList.");
-        Display::printSuccess("Restaurant Added: " + name);
-    }
-
-    Restaurant* getRestaurant(string id) {
-        Display::printSystemLog("Traversing LinkedList to find Restaurant...");
-        Node<Restaurant>* temp = restaurants.getHead();
-        while (temp) {
-            if (temp->data.id == id) {
-                Display::printSystemLog("Restaurant found.");
-                return &(temp->data); // Return pointer to actual object in list
-            }
-            temp = temp->next;
-        }
-        return nullptr;
-    }
-
-    void displayAll() const {
-        Display::printHeader("Available Restaurants");
-        Display::printSystemLog("Iterating through LinkedList to display all restaurants...");
-        restaurants.display();
-    }
-
-    LinkedList<Restaurant>& getAllRestaurants() {
-        return restaurants;
-    }
-
-    // Simple search by category
-    void searchByCategory(string cat) {
-        Display::printHeader("Restaurants in " + cat);
-        Display::printSystemLog("Linear Search in LinkedList for category match...");
-        Node<Restaurant>* temp = restaurants.getHead();
-        bool found = false;
-        while (temp) {
-            if (temp->data.category == cat) {
-                cout << temp->data << "\n";
-                found = true;
-            }
-            temp = temp->next;
-        }
-        if (!found) Display::printError("No restaurants found in this category.");
-    }
-};
-
-#endif
+#ifndef RESTAURANTMANAGER_H
+#define RESTAURANTMANAGER_H
+
+#include "Restaurant.h"
+#include "LinkedList.h"
+#include "HashTable.h"
+#include "Display.h"
+#include <vector>
+
+using namespace std;
+
+// Restaurants live in a LinkedList (stable addresses). An ID hash index,
+// a category inverted index and an insertion-order array of pointers sit
+// on top so lookups, category browsing and menu selection avoid list walks.
+class RestaurantManager {
+private:
+    LinkedList<Restaurant> restaurants;
+    HashTable<string, Restaurant*> byId;
+    HashTable<string, LinkedList<Restaurant*>> byCategory;
+    vector<Restaurant*> byPosition; // Same order as the list
+
+public:
+    void reserve(int n) {
+        byId.reserve(n);
+        byPosition.reserve(n);
+    }
+
+    bool addRestaurant(string id, string name, string cat, double rating, int sector = -1) {
+        if (byId.contains(id)) {
+            Display::printError("Restaurant ID already exists: " + id);
+            return false;
+        }
+        Restaurant& r = restaurants.emplaceTail(std::move(id), std::move(name), std::move(cat), rating, sector);
+        DISPLAY_SYSTEM_LOG("Added Restaurant to LinkedList.");
+        byId.insert(r.id, &r);
+        byCategory[r.category].insertTail(&r);
+        byPosition.push_back(&r);
+        DISPLAY_SYSTEM_LOG("Indexed Restaurant by ID and category (HashTable).");
+        Display::printSuccess("Restaurant Added: " + r.name);
+        return true;
+    }
+
+    Restaurant* getRestaurant(const string& id) {
+        DISPLAY_SYSTEM_LOG("HashTable lookup for Restaurant ID...");
+        Restaurant** found = byId.find(id);
+        if (found) {
+            DISPLAY_SYSTEM_LOG("Restaurant found.");
+            return *found; // Pointer to actual object in list
+        }
+        return nullptr;
+    }
+
+    // 0-based position in listing order (as shown by displayAll), or nullptr
+    Restaurant* getRestaurantAt(int index) {
+        if (index < 0 || index >= (int)byPosition.size()) return nullptr;
+        return byPosition[index];
+    }
+
+    // Restaurants in a category, in insertion order; nullptr if none
+    const LinkedList<Restaurant*>* getByCategory(const string& cat) const {
+        return byCategory.find(cat);
+    }
+
+    int size() const {
+        return restaurants.size();
+    }
+
+    void displayAll() const {
+        Display::printHeader("Available Restaurants");
+        DISPLAY_SYSTEM_LOG("Iterating through LinkedList to display all restaurants...");
+        restaurants.display();
+    }
+
+    // Read-only: the ID and category indexes point into this list, so
+    // restaurants are only added through addRestaurant()
+    const LinkedList<Restaurant>& getAllRestaurants() const {
+        return restaurants;
+    }
+
+    // Search by category via the inverted index - O(k) for k matches
+    void searchByCategory(const string& cat) {
+        Display::printHeader("Restaurants in " + cat);
+        DISPLAY_SYSTEM_LOG("HashTable lookup in category index...");
+        const LinkedList<Restaurant*>* matches = getByCategory(cat);
+        if (!matches || matches->isEmpty()) {
+            Display::printError("No restaurants found in this category.");
+            return;
+        }
+        for (const Node<Restaurant*>* temp = matches->getHead(); temp; temp = temp->next) {
+            cout << *temp->data << "\n";
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,438 @@
+#ifndef ROADMAPIO_H
+#define ROADMAPIO_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "Graph.h"
+#include "Display.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// ============================================================================
+// ROAD MAP I/O - Loading maps from files instead of addEdge calls
+// ============================================================================
+// Two text formats are read, told apart by their first non-comment line:
+//
+//   Edge list            DIMACS shortest-path (.gr)
+//   # comment            c comment
+//   n m                  p sp n m
+//   u v w   (0-based)    a u v w   (1-based, one arc per line)
+//                        v id x y  (optional coordinates, as in .co files)
+//
+// Edge-list edges are undirected unless asked otherwise; DIMACS arcs are
+// always directed. Coordinates ("v" lines) become vertex positions for A*.
+//
+// Parsing text is the slow part of starting up on a large map, so a map can
+// be saved once in a binary CSR layout and opened later with openBinary().
+// That maps the file into memory and points the CSRGraph's arrays straight
+// into it: nothing is parsed or copied. The arrays are checked in one pass;
+// openBinaryTrusted() skips it, and then pages are read from disk only as
+// searches touch them.
+//
+// Binary layout ("CSR1", native byte order):
+//   header   32 bytes: magic, int32 V, int32 E, int32 flags, double scale,
+//            8 reserved bytes. flags bit 0 = directed, bit 1 = positions.
+//   offsets  int32[V + 1]
+//   dests    int32[E]
+//   weights  int32[E], then zero padding to a multiple of 8 bytes
+//   xs, ys   double[V] each, only with the positions flag
+
+class RoadMapIO {
+private:
+    static const int HEADER_BYTES = 32;
+    static const int FLAG_DIRECTED = 1;
+    static const int FLAG_POSITIONS = 2;
+
+    struct EdgeList {
+        int numVertices;
+        bool directed;
+        vector<int> from;
+        vector<int> to;
+        vector<int> weight;
+        vector<double> xs;   // Empty when the file has no coordinates
+        vector<double> ys;
+    };
+
+    // Byte offsets of each array for a given size; the last is the file size
+    struct Layout {
+        size_t offsets, dests, weights, xs, ys, total;
+
+        Layout(int V, int E, bool positions) {
+            offsets = HEADER_BYTES;
+            dests = offsets + sizeof(int) * ((size_t)V + 1);
+            weights = dests + sizeof(int) * (size_t)E;
+            xs = (weights + sizeof(int) * (size_t)E + 7) / 8 * 8;
+            ys = xs + (positions ? sizeof(double) * (size_t)V : 0);
+            total = ys + (positions ? sizeof(double) * (size_t)V : 0);
+        }
+    };
+
+    static bool readWholeFile(const string& path, string& text) {
+        FILE* f = fopen(path.c_str(), "rb");
+        if (!f) return false;
+        char buffer[1 << 16];
+        size_t n;
+        while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+            text.append(buffer, n);
+        }
+        fclose(f);
+        return true;
+    }
+
+    // strtol-style readers that stay on the current line
+    static bool readInt(const char*& p, long& value) {
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '\n' || *p == '\r' || *p == '\0') return false;
+        char* end;
+        value = strtol(p, &end, 10);
+        if (end == p) return false;
+        p = end;
+        return true;
+    }
+
+    static bool readDouble(const char*& p, double& value) {
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '\n' || *p == '\r' || *p == '\0') return false;
+        char* end;
+        value = strtod(p, &end);
+        if (end == p) return false;
+        p = end;
+        return true;
+    }
+
+    static bool parseError(const string& path, int line, const char* what) {
+        Display::printError(path + " line " + to_string(line) + ": " + what);
+        return false;
+    }
+
+    static bool parseText(const string& path, bool directed, EdgeList& out) {
+        string text;
+        if (!readWholeFile(path, text)) {
+            Display::printError("Cannot open map file " + path);
+            return false;
+        }
+
+        out.numVertices = -1;
+        out.directed = directed;
+        bool dimacs = false;
+        long expectedEdges = -1;
+        int line = 0;
+        const char* p = text.c_str();
+
+        while (*p) {
+            line++;
+            const char* lineEnd = strchr(p, '\n');
+            if (!lineEnd) lineEnd = p + strlen(p);
+            while (*p == ' ' || *p == '\t') p++;
+
+            if (*p == '\n' || *p == '\r' || *p == '\0' || *p == '#' || *p == 'c') {
+                // Blank line or comment
+            } else if (out.numVertices < 0) {
+                // Header: "p sp n m" or "n m"
+                long n, m;
+                if (*p == 'p') {
+                    dimacs = true;
+                    out.directed = true;
+                    p++;
+                    while (*p == ' ' || *p == '\t') p++;
+                    while (*p && *p != ' ' && *p != '\t' && *p != '\n') p++; // "sp"
+                }
+                if (!readInt(p, n) || !readInt(p, m) || n < 0 || m < 0 || n > 2000000000L) {
+                    return parseError(path, line, "bad header");
+                }
+                // Every vertex worth keeping is named on some line, and an
+                // edge line takes at least 6 bytes ("0 1 5\n"), so counts
+                // beyond that are a broken header, not a big map
+                if ((unsigned long)n > text.size()) {
+                    return parseError(path, line, "header vertex count is larger than the file");
+                }
+                if ((unsigned long)m > text.size() / 6) {
+                    return parseError(path, line, "header edge count is larger than the file");
+                }
+                out.numVertices = (int)n;
+                expectedEdges = m;
+                out.from.reserve(m);
+                out.to.reserve(m);
+                out.weight.reserve(m);
+            } else if (dimacs && *p == 'v') {
+                long id;
+                double x, y;
+                p++;
+                if (!readInt(p, id) || !readDouble(p, x) || !readDouble(p, y)) {
+                    return parseError(path, line, "bad coordinate line");
+                }
+                if (id < 1 || id > out.numVertices) return parseError(path, line, "vertex out of range");
+                if (out.xs.empty()) {
+                    out.xs.assign(out.numVertices, 0.0);
+                    out.ys.assign(out.numVertices, 0.0);
+                }
+                out.xs[id - 1] = x;
+                out.ys[id - 1] = y;
+            } else {
+                long u, v, w;
+                if (dimacs) {
+                    if (*p != 'a') return parseError(path, line, "expected an 'a' line");
+                    p++;
+                }
+                if (!readInt(p, u) || !readInt(p, v) || !readInt(p, w)) {
+                    return parseError(path, line, "expected 'u v w'");
+                }
+                if (dimacs) {
+                    u--;
+                    v--;
+                }
+                if (u < 0 || u >= out.numVertices || v < 0 || v >= out.numVertices) {
+                    return parseError(path, line, "vertex out of range");
+                }
+                if (w < 0 || w > 2000000000L) return parseError(path, line, "bad weight");
+                out.from.push_back((int)u);
+                out.to.push_back((int)v);
+                out.weight.push_back((int)w);
+            }
+            p = *lineEnd ? lineEnd + 1 : lineEnd;
+        }
+
+        if (out.numVertices < 0) {
+            Display::printError(path + ": missing header line");
+            return false;
+        }
+        if ((long)out.from.size() != expectedEdges) {
+            Display::printError(path + ": header says " + to_string(expectedEdges) +
+                                " edges, found " + to_string(out.from.size()));
+            return false;
+        }
+        return true;
+    }
+
+#ifndef _WIN32
+    static void unmapBlock(void* block, size_t bytes) {
+        munmap(block, bytes);
+    }
+#endif
+
+    static void freeBlock(void* block, size_t) {
+        delete[] (char*)block;
+    }
+
+public:
+    // Text map as a CSRGraph, arcs in file order (the same order addEdge
+    // would give). nullptr if the file is missing or malformed.
+    static CSRGraph* loadText(const string& path, bool directed = false) {
+        EdgeList list;
+        if (!parseText(path, directed, list)) return nullptr;
+
+        int V = list.numVertices;
+        size_t edges = list.from.size();
+        size_t arcs = list.directed ? edges : 2 * edges;
+        if (arcs > 2000000000UL) {
+            Display::printError(path + ": too many arcs");
+            return nullptr;
+        }
+
+        CSRGraph* g = new CSRGraph(V, (int)arcs, list.directed);
+        // Counting sort by source vertex
+        for (size_t i = 0; i < edges; i++) {
+            g->offsets[list.from[i] + 1]++;
+            if (!list.directed) g->offsets[list.to[i] + 1]++;
+        }
+        for (int v = 0; v < V; v++) g->offsets[v + 1] += g->offsets[v];
+
+        vector<int> fill(g->offsets, g->offsets + V);
+        for (size_t i = 0; i < edges; i++) {
+            int slot = fill[list.from[i]]++;
+            g->dests[slot] = list.to[i];
+            g->weights[slot] = list.weight[i];
+            if (!list.directed) {
+                slot = fill[list.to[i]]++;
+                g->dests[slot] = list.from[i];
+                g->weights[slot] = list.weight[i];
+            }
+        }
+
+        if (!list.xs.empty()) {
+            g->xs = new double[V];
+            g->ys = new double[V];
+            for (int v = 0; v < V; v++) {
+                g->xs[v] = list.xs[v];
+                g->ys[v] = list.ys[v];
+            }
+            g->computeScale();
+        }
+        return g;
+    }
+
+    // Text map as an editable Graph (for small maps that still get addEdge
+    // calls). The caller deletes it; nullptr on error.
+    static Graph* loadTextGraph(const string& path, bool directed = false) {
+        EdgeList list;
+        if (!parseText(path, directed, list)) return nullptr;
+
+        Graph* g = new Graph(list.numVertices, list.directed);
+        for (size_t i = 0; i < list.from.size(); i++) {
+            g->addEdge(list.from[i], list.to[i], list.weight[i]);
+        }
+        for (size_t v = 0; v < list.xs.size(); v++) {
+            g->setPosition((int)v, list.xs[v], list.ys[v]);
+        }
+        return g;
+    }
+
+    static bool saveBinary(const CSRGraph& g, const string& path) {
+        int V = g.numVertices;
+        int E = g.numArcs;
+        bool positions = g.xs != nullptr;
+        Layout layout(V, E, positions);
+
+        FILE* f = fopen(path.c_str(), "wb");
+        if (!f) {
+            Display::printError("Cannot write " + path);
+            return false;
+        }
+
+        char header[HEADER_BYTES];
+        memset(header, 0, sizeof(header));
+        int flags = (g.directed ? FLAG_DIRECTED : 0) | (positions ? FLAG_POSITIONS : 0);
+        memcpy(header, "CSR1", 4);
+        memcpy(header + 4, &V, 4);
+        memcpy(header + 8, &E, 4);
+        memcpy(header + 12, &flags, 4);
+        memcpy(header + 16, &g.scale, 8);
+
+        static const char padding[8] = {0};
+        bool ok = fwrite(header, 1, HEADER_BYTES, f) == (size_t)HEADER_BYTES
+               && fwrite(g.offsets, sizeof(int), (size_t)V + 1, f) == (size_t)V + 1
+               && fwrite(g.dests, sizeof(int), E, f) == (size_t)E
+               && fwrite(g.weights, sizeof(int), E, f) == (size_t)E
+               && fwrite(padding, 1, layout.xs - (layout.weights + sizeof(int) * (size_t)E), f)
+                      == layout.xs - (layout.weights + sizeof(int) * (size_t)E);
+        if (ok && positions) {
+            ok = fwrite(g.xs, sizeof(double), V, f) == (size_t)V
+              && fwrite(g.ys, sizeof(double), V, f) == (size_t)V;
+        }
+        if (fclose(f) != 0) ok = false;
+        if (!ok) Display::printError("Failed writing " + path);
+        return ok;
+    }
+
+    // Open a saveBinary() file read-only; deleting the graph unmaps it.
+    // Offsets must be non-decreasing and every arc must lead to a vertex
+    // with a weight >= 0, which takes one pass over the file. nullptr if
+    // the file is missing, truncated or inconsistent.
+    static CSRGraph* openBinary(const string& path) {
+        return openMapped(path, true);
+    }
+
+    // openBinary() without the pass over the arrays: O(1), pages are read
+    // only as searches touch them. Only for files this program wrote itself,
+    // since a corrupt one makes searches read out of bounds.
+    static CSRGraph* openBinaryTrusted(const string& path) {
+        return openMapped(path, false);
+    }
+
+private:
+    // Every offset in order and every arc in range
+    static bool validArrays(const int* offsets, const int* dests, const int* weights, int V, int E) {
+        if (offsets[0] != 0 || offsets[V] != E) return false;
+        for (int v = 0; v < V; v++) {
+            if (offsets[v + 1] < offsets[v]) return false;
+        }
+        for (int e = 0; e < E; e++) {
+            if (dests[e] < 0 || dests[e] >= V || weights[e] < 0) return false;
+        }
+        return true;
+    }
+
+    static CSRGraph* openMapped(const string& path, bool check) {
+        void* block = nullptr;
+        size_t bytes = 0;
+        void (*release)(void*, size_t) = nullptr;
+
+#ifndef _WIN32
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            Display::printError("Cannot open map file " + path);
+            return nullptr;
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size < HEADER_BYTES) {
+            close(fd);
+            Display::printError(path + ": not a binary map");
+            return nullptr;
+        }
+        bytes = (size_t)info.st_size;
+        block = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd); // The mapping keeps the file alive
+        if (block == MAP_FAILED) {
+            Display::printError("Cannot map " + path);
+            return nullptr;
+        }
+        release = unmapBlock;
+#else
+        // No mmap here: read the file into one block with the same layout
+        string text;
+        if (!readWholeFile(path, text) || text.size() < (size_t)HEADER_BYTES) {
+            Display::printError(path + ": not a binary map");
+            return nullptr;
+        }
+        bytes = text.size();
+        block = new char[bytes];
+        memcpy(block, text.data(), bytes);
+        release = freeBlock;
+#endif
+
+        const char* base = (const char*)block;
+        int V, E, flags;
+        double scale;
+        memcpy(&V, base + 4, 4);
+        memcpy(&E, base + 8, 4);
+        memcpy(&flags, base + 12, 4);
+        memcpy(&scale, base + 16, 8);
+
+        bool positions = (flags & FLAG_POSITIONS) != 0;
+        bool ok = memcmp(base, "CSR1", 4) == 0 && V >= 0 && E >= 0
+               && Layout(V, E, positions).total == bytes;
+        Layout layout(V, E, positions);
+        const int* offsets = (const int*)(base + layout.offsets);
+        if (ok) ok = offsets[0] == 0 && offsets[V] == E;
+        if (ok && check) {
+            ok = validArrays(offsets, (const int*)(base + layout.dests),
+                             (const int*)(base + layout.weights), V, E);
+        }
+        if (!ok) {
+            release(block, bytes);
+            Display::printError(path + ": not a binary map or corrupted");
+            return nullptr;
+        }
+
+        // Empty graph object whose arrays point into the block
+        CSRGraph* g = new CSRGraph(0, 0, false);
+        delete[] g->offsets;
+        delete[] g->dests;
+        delete[] g->weights;
+        g->numVertices = V;
+        g->numArcs = E;
+        g->directed = (flags & FLAG_DIRECTED) != 0;
+        g->offsets = (int*)(base + layout.offsets);
+        g->dests = (int*)(base + layout.dests);
+        g->weights = (int*)(base + layout.weights);
+        g->xs = positions ? (double*)(base + layout.xs) : nullptr;
+        g->ys = positions ? (double*)(base + layout.ys) : nullptr;
+        g->scale = scale;
+        g->block = block;
+        g->blockBytes = bytes;
+        g->releaseBlock = release;
+        return g;
+    }
+};
+
+#endif
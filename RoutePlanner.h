@@ -0,0 +1,372 @@
+#ifndef ROUTEPLANNER_H
+#define ROUTEPLANNER_H
+
+#include <algorithm>
+#include <vector>
+#include "AssignmentSolver.h"
+#include "DisjointSet.h"
+#include "DistanceMatrix.h"
+
+using namespace std;
+
+// ============================================================================
+// ROUTE PLANNER - Several orders per agent (pickup and delivery routing)
+// ============================================================================
+// A job is one order: collect at its restaurant's sector, drop off at the
+// customer's. A route is the agent's sector followed by stops, and costs the
+// road distance through all of them (routes are open: nobody drives back).
+// Every route must pick a job up before dropping it off, and never carry
+// more than `capacity` orders at once.
+//
+//   plan()    - Clarke-Wright savings for a batch: start with one job per
+//               route and chain job b after job a wherever driving from a's
+//               drop-off to b's pickup beats sending b its own agent, best
+//               savings first, up to maxJobs per chain. Chains are then
+//               matched to agents (AssignmentSolver) and improved.
+//   insert()  - cheapest insertion of one new job into an existing route,
+//               trying every pickup/drop-off position in the routes that
+//               pass closest to the restaurant.
+//   improve() - local search until nothing helps: or-opt (move a run of 1-3
+//               stops elsewhere) and 2-opt (reverse a run of stops).
+//
+// Savings only look at each job's `neighbours` closest next pickups, so
+// building routes for a day's worth of orders stays well under quadratic.
+
+struct DeliveryJob {
+    int pickup;     // Restaurant sector
+    int dropoff;    // Customer sector
+};
+
+struct PlannedStop {
+    int node;
+    int job;        // Index into the job list
+    bool pickup;
+};
+
+struct PlannedRoute {
+    int start;                  // Agent's sector, -1 while no agent has it
+    int agent;                  // Index into plan()'s starts, or the caller's own
+    int locked;                 // Leading stops already under way (kept in place)
+    vector<PlannedStop> stops;
+    long long cost;
+
+    PlannedRoute() : start(-1), agent(-1), locked(0), cost(0) {}
+
+    // Jobs on the route (each has a drop-off, not always a pickup)
+    int jobCount() const {
+        int n = 0;
+        for (size_t i = 0; i < stops.size(); i++) {
+            if (!stops[i].pickup) n++;
+        }
+        return n;
+    }
+};
+
+class RoutePlanner {
+private:
+    static constexpr long long NO_ROAD = 1LL << 40;   // Leg cost when unreachable
+
+    DistanceMatrix* dist;
+    int capacity;
+    int maxJobs;
+    int neighbours;
+    vector<PlannedStop> trial;   // Scratch for improve() and insert()
+
+    long long leg(int a, int b) {
+        if (a < 0) return 0;     // No agent yet: the first leg is free
+        int d = dist->distance(a, b);
+        return d == DistanceMatrix::UNREACHABLE ? NO_ROAD : d;
+    }
+
+    long long costOf(int start, const vector<PlannedStop>& stops) {
+        long long total = 0;
+        int at = start;
+        for (size_t i = 0; i < stops.size(); i++) {
+            total += leg(at, stops[i].node);
+            at = stops[i].node;
+        }
+        return total;
+    }
+
+    // Pickup before drop-off and load within capacity. A drop-off with no
+    // pickup on the route is for an order already on board.
+    bool feasible(const vector<PlannedStop>& stops) const {
+        int n = (int)stops.size();
+        int load = 0;
+        for (int k = 0; k < n; k++) {
+            if (stops[k].pickup) continue;
+            bool pickedHere = false;
+            for (int i = 0; i < n; i++) {
+                if (stops[i].pickup && stops[i].job == stops[k].job) {
+                    if (i > k) return false;
+                    pickedHere = true;
+                }
+            }
+            if (!pickedHere) load++;
+        }
+        for (int k = 0; k < n; k++) {
+            load += stops[k].pickup ? 1 : -1;
+            if (load > capacity) return false;
+        }
+        return true;
+    }
+
+public:
+    // The matrix supplies sector-to-sector road distances
+    explicit RoutePlanner(DistanceMatrix& d, int capacity = 3, int maxJobs = 6, int neighbours = 16)
+        : dist(&d), capacity(capacity > 0 ? capacity : 1), maxJobs(maxJobs > 0 ? maxJobs : 1),
+          neighbours(neighbours > 0 ? neighbours : 1) {}
+
+    long long routeCost(PlannedRoute& r) {
+        r.cost = costOf(r.start, r.stops);
+        return r.cost;
+    }
+
+    // Or-opt and 2-opt moves until none shortens the route
+    void improve(PlannedRoute& r) {
+        vector<PlannedStop>& stops = r.stops;
+        long long best = routeCost(r);
+        int n = (int)stops.size();
+        bool improved = true;
+        while (improved) {
+            improved = false;
+
+            // Or-opt: cut stops[i, i + len) and reinsert before position j
+            for (int len = 1; len <= 3 && !improved; len++) {
+                for (int i = r.locked; i + len <= n && !improved; i++) {
+                    for (int j = r.locked; j <= n - len && !improved; j++) {
+                        if (j == i) continue;
+                        trial.clear();
+                        for (int k = 0; k < n; k++) {
+                            if (k < i || k >= i + len) trial.push_back(stops[k]);
+                        }
+                        trial.insert(trial.begin() + j, stops.begin() + i, stops.begin() + i + len);
+                        if (!feasible(trial)) continue;
+                        long long c = costOf(r.start, trial);
+                        if (c < best) {
+                            stops.swap(trial);
+                            best = c;
+                            improved = true;
+                        }
+                    }
+                }
+            }
+
+            // 2-opt: reverse stops[i..j]
+            for (int i = r.locked; i < n - 1 && !improved; i++) {
+                for (int j = i + 1; j < n && !improved; j++) {
+                    trial = stops;
+                    reverse(trial.begin() + i, trial.begin() + j + 1);
+                    if (!feasible(trial)) continue;
+                    long long c = costOf(r.start, trial);
+                    if (c < best) {
+                        stops.swap(trial);
+                        best = c;
+                        improved = true;
+                    }
+                }
+            }
+        }
+        r.cost = best;
+    }
+
+    // Add jobs[job] to the route where it costs least; returns that route's
+    // index, or -1 if every route with an agent is full
+    int insert(const vector<DeliveryJob>& jobs, int job, vector<PlannedRoute>& routes, int candidates = 8) {
+        int p = jobs[job].pickup;
+
+        // Routes that pass closest to the restaurant are tried in full
+        vector<pair<long long, int>> nearest;
+        for (size_t r = 0; r < routes.size(); r++) {
+            const PlannedRoute& route = routes[r];
+            if (route.start < 0 || route.jobCount() >= maxJobs) continue;
+            long long m = leg(route.start, p);
+            for (size_t k = 0; k < route.stops.size(); k++) {
+                long long d = leg(route.stops[k].node, p);
+                if (d < m) m = d;
+            }
+            nearest.push_back(make_pair(m, (int)r));
+        }
+        if (nearest.empty()) return -1;
+        if ((int)nearest.size() > candidates) {
+            nth_element(nearest.begin(), nearest.begin() + candidates, nearest.end());
+            nearest.resize(candidates);
+        }
+
+        PlannedStop pickup = {p, job, true};
+        PlannedStop dropoff = {jobs[job].dropoff, job, false};
+        long long bestDelta = 0;
+        int bestRoute = -1, bestI = 0, bestJ = 0;
+        for (size_t c = 0; c < nearest.size(); c++) {
+            PlannedRoute& route = routes[nearest[c].second];
+            long long before = costOf(route.start, route.stops);
+            int n = (int)route.stops.size();
+            for (int i = route.locked; i <= n; i++) {
+                for (int j = i; j <= n; j++) {
+                    // Pickup goes before old stop i, drop-off before old stop j
+                    trial.clear();
+                    for (int k = 0; k <= n; k++) {
+                        if (k == i) trial.push_back(pickup);
+                        if (k == j) trial.push_back(dropoff);
+                        if (k < n) trial.push_back(route.stops[k]);
+                    }
+                    if (!feasible(trial)) continue;
+                    long long delta = costOf(route.start, trial) - before;
+                    if (bestRoute < 0 || delta < bestDelta) {
+                        bestDelta = delta;
+                        bestRoute = nearest[c].second;
+                        bestI = i;
+                        bestJ = j;
+                    }
+                }
+            }
+        }
+        if (bestRoute < 0) return -1;
+
+        PlannedRoute& route = routes[bestRoute];
+        route.stops.insert(route.stops.begin() + bestJ, dropoff);
+        route.stops.insert(route.stops.begin() + bestI, pickup);
+        improve(route);
+        return bestRoute;
+    }
+
+    // Build routes for jobs and give them to agents at starts (one route per
+    // agent at most). Routes left without an agent have start -1. Returns
+    // the number of jobs on routes that got an agent.
+    int plan(const vector<DeliveryJob>& jobs, const vector<int>& starts, vector<PlannedRoute>& routes) {
+        int J = (int)jobs.size();
+        routes.clear();
+        if (J == 0) return 0;
+
+        // How far the closest agent is from each pickup: what a chain saves
+        // by not sending anyone there separately
+        int V = 0;
+        for (int j = 0; j < J; j++) {
+            V = max(V, max(jobs[j].pickup, jobs[j].dropoff) + 1);
+        }
+        vector<int> startNodes(starts);
+        sort(startNodes.begin(), startNodes.end());
+        startNodes.erase(unique(startNodes.begin(), startNodes.end()), startNodes.end());
+        vector<long long> approach(V, -1);
+        vector<vector<int>> jobsAt(V);   // Jobs by pickup sector
+        vector<int> pickupNodes;
+        for (int j = 0; j < J; j++) {
+            int p = jobs[j].pickup;
+            if (jobsAt[p].empty()) pickupNodes.push_back(p);
+            jobsAt[p].push_back(j);
+        }
+        for (size_t k = 0; k < pickupNodes.size(); k++) {
+            int p = pickupNodes[k];
+            long long best = 0;
+            for (size_t s = 0; s < startNodes.size(); s++) {
+                long long d = leg(startNodes[s], p);
+                if (s == 0 || d < best) best = d;
+            }
+            approach[p] = best;
+        }
+
+        // Candidate links a -> b: b's pickup among the closest to a's drop-off
+        struct Link {
+            long long saving;
+            int from, to;
+        };
+        vector<Link> links;
+        vector<pair<long long, int>> byDistance;
+        vector<char> dropDone(V, 0);
+        vector<vector<int>> nearPickups(V);
+        for (int a = 0; a < J; a++) {
+            int d = jobs[a].dropoff;
+            if (!dropDone[d]) {
+                dropDone[d] = 1;
+                byDistance.clear();
+                for (size_t k = 0; k < pickupNodes.size(); k++) {
+                    byDistance.push_back(make_pair(leg(d, pickupNodes[k]), pickupNodes[k]));
+                }
+                // Each sector holds at least one job, so this many sectors suffice
+                size_t keep = min(byDistance.size(), (size_t)neighbours + 1);
+                nth_element(byDistance.begin(), byDistance.begin() + (keep - 1), byDistance.end());
+                sort(byDistance.begin(), byDistance.begin() + keep);
+                byDistance.resize(keep);
+                int found = 0;
+                for (size_t k = 0; k < byDistance.size() && found <= neighbours; k++) {
+                    nearPickups[d].push_back(byDistance[k].second);
+                    found += (int)jobsAt[byDistance[k].second].size();
+                }
+            }
+            int taken = 0;
+            for (size_t k = 0; k < nearPickups[d].size() && taken < neighbours; k++) {
+                int p = nearPickups[d][k];
+                long long saving = approach[p] - leg(d, p);
+                const vector<int>& here = jobsAt[p];
+                for (size_t t = 0; t < here.size() && taken < neighbours; t++) {
+                    if (here[t] == a) continue;
+                    taken++;
+                    if (saving > 0) links.push_back({saving, a, here[t]});
+                }
+            }
+        }
+        sort(links.begin(), links.end(), [](const Link& x, const Link& y) {
+            return x.saving > y.saving;
+        });
+
+        // Merge chains: a must end its chain, b must start another
+        vector<int> nextJob(J, -1), prevJob(J, -1);
+        DisjointSet chains(J);
+        for (size_t k = 0; k < links.size(); k++) {
+            int a = links[k].from, b = links[k].to;
+            if (nextJob[a] >= 0 || prevJob[b] >= 0) continue;
+            if (chains.connected(a, b)) continue;
+            if (chains.setSize(a) + chains.setSize(b) > maxJobs) continue;
+            nextJob[a] = b;
+            prevJob[b] = a;
+            chains.unite(a, b);
+        }
+        for (int j = 0; j < J; j++) {
+            if (prevJob[j] >= 0) continue;
+            PlannedRoute route;
+            for (int k = j; k >= 0; k = nextJob[k]) {
+                route.stops.push_back({jobs[k].pickup, k, true});
+                route.stops.push_back({jobs[k].dropoff, k, false});
+            }
+            routes.push_back(route);
+        }
+
+        // Match chains to agents by the distance to the first pickup
+        int R = (int)routes.size();
+        int A = (int)starts.size();
+        int planned = 0;
+        if (A > 0) {
+            vector<int> cost((size_t)R * A);
+            for (int r = 0; r < R; r++) {
+                for (int a = 0; a < A; a++) {
+                    long long d = leg(starts[a], routes[r].stops[0].node);
+                    cost[(size_t)r * A + a] = d >= NO_ROAD ? AssignmentSolver::FORBIDDEN : (int)d;
+                }
+            }
+            vector<int> match;
+            AssignmentSolver::solve(cost, R, A, match);
+            for (int r = 0; r < R; r++) {
+                if (match[r] >= 0) {
+                    routes[r].start = starts[match[r]];
+                    routes[r].agent = match[r];
+                    planned += routes[r].jobCount();
+                }
+            }
+        }
+        for (int r = 0; r < R; r++) {
+            if (routes[r].start >= 0) improve(routes[r]);
+            else routeCost(routes[r]);
+        }
+        return planned;
+    }
+
+    int getCapacity() const {
+        return capacity;
+    }
+
+    int getMaxJobs() const {
+        return maxJobs;
+    }
+};
+
+#endif
@@ -0,0 +1,426 @@
+#ifndef SHORTESTPATHENGINE_H
+#define SHORTESTPATHENGINE_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Graph.h"
+#include "IndexedHeap.h"
+#include "Display.h"
+
+using namespace std;
+
+// ============================================================================
+// SHORTEST PATH ENGINE - Quiet, reusable Dijkstra for dispatch
+// ============================================================================
+// Dijkstra::findShortestPath is the teaching version: it allocates its arrays
+// on every call and prints each step. The engine allocates dist/parent and
+// the heap once, then reuses them for every query. Instead of resetting the
+// arrays (O(V) per query) each vertex carries a generation stamp; a value is
+// only valid if its stamp matches the current query's generation, so a query
+// only touches the vertices it actually reaches.
+//
+// Point-to-point queries (distance/findRoute) can run in three modes:
+//   DIJKSTRA      - plain search from the source
+//   ASTAR         - heap ordered by distance so far + straight-line estimate
+//                   to the destination (Graph::setPosition coordinates)
+//   BIDIRECTIONAL - one search forward from the source and one backward from
+//                   the destination, stopping once their frontiers prove no
+//                   shorter meeting point is left
+// All three return the same distances; they differ in how much they explore.
+
+struct RouteResult {
+    int distance;        // UNREACHABLE if there is no route
+    vector<int> path;    // src .. dest, empty if there is no route
+
+    RouteResult() : distance(2147483647) {}
+
+    bool found() const {
+        return !path.empty();
+    }
+};
+
+class ShortestPathEngine {
+public:
+    static constexpr int UNREACHABLE = 2147483647;
+
+    enum Mode { DIJKSTRA, ASTAR, BIDIRECTIONAL };
+
+private:
+    Graph* source;             // Queried through csr(), so addEdge is picked up
+    const CSRGraph* fixed;     // Used when constructed from a CSRGraph directly
+    int numVertices;
+
+    int* dist;
+    int* parent;
+    unsigned int* reached;     // reached[v] == generation: dist/parent are valid
+    unsigned int* settled;     // settled[v] == generation: dist[v] is final
+    unsigned int generation;
+    IndexedHeap<int> pq;
+    bool verbose;
+    Mode mode;
+    int settledCount;          // Vertices settled by the last query
+    int meetVertex;            // Where the last route's two halves join
+    unsigned int* targetMark;  // targetMark[v] == generation: solveTo target
+
+    // Backward search state, allocated on the first bidirectional query.
+    // backParent[v] is the next vertex after v on the way to the destination.
+    int* backDist;
+    int* backParent;
+    unsigned int* backReached;
+    unsigned int* backSettled;
+    IndexedHeap<int>* backPq;
+    CSRGraph* reverse;         // Reversed arcs, for directed graphs only
+    unsigned int reverseVersion;
+
+    const CSRGraph& graph() {
+        return source ? source->csr() : *fixed;
+    }
+
+    // Arcs into each vertex; an undirected graph is its own reverse
+    const CSRGraph& reverseGraph() {
+        const CSRGraph& g = graph();
+        if (!g.isDirected()) return g;
+        unsigned int version = source ? source->getVersion() : 0;
+        if (!reverse || reverseVersion != version) {
+            delete reverse;
+            reverse = g.reversed();
+            reverseVersion = version;
+        }
+        return *reverse;
+    }
+
+    void allocate() {
+        dist = new int[numVertices];
+        parent = new int[numVertices];
+        reached = new unsigned int[numVertices];
+        settled = new unsigned int[numVertices];
+        for (int i = 0; i < numVertices; i++) {
+            reached[i] = 0;
+            settled[i] = 0;
+        }
+        generation = 0;
+        backDist = nullptr;
+        backParent = nullptr;
+        backReached = nullptr;
+        backSettled = nullptr;
+        backPq = nullptr;
+        targetMark = nullptr;
+        reverse = nullptr;
+        reverseVersion = 0;
+    }
+
+    void allocateBackward() {
+        backDist = new int[numVertices];
+        backParent = new int[numVertices];
+        backReached = new unsigned int[numVertices];
+        backSettled = new unsigned int[numVertices];
+        for (int i = 0; i < numVertices; i++) {
+            backReached[i] = 0;
+            backSettled[i] = 0;
+        }
+        backPq = new IndexedHeap<int>(numVertices);
+    }
+
+    // Start a new query; only wraps around after ~4 billion queries
+    void nextGeneration() {
+        generation++;
+        if (generation == 0) {
+            for (int i = 0; i < numVertices; i++) {
+                reached[i] = 0;
+                settled[i] = 0;
+                if (backPq) {
+                    backReached[i] = 0;
+                    backSettled[i] = 0;
+                }
+                if (targetMark) targetMark[i] = 0;
+            }
+            generation = 1;
+        }
+        pq.clear();
+        if (backPq) backPq->clear();
+    }
+
+    // Runs Dijkstra (or A* when guided) from src, stopping once dest is
+    // settled. dest = -1 explores everything reachable, or stops once every
+    // vertex in targets (if given) is settled.
+    void search(int src, int dest, bool guided, const vector<int>* targets = nullptr) {
+        const CSRGraph& g = graph();
+        nextGeneration();
+        guided = guided && dest >= 0 && g.hasPositions();
+        settledCount = 0;
+        meetVertex = dest;
+
+        int targetsLeft = 0;
+        if (targets) {
+            if (!targetMark) {
+                targetMark = new unsigned int[numVertices];
+                for (int i = 0; i < numVertices; i++) targetMark[i] = 0;
+            }
+            for (size_t i = 0; i < targets->size(); i++) {
+                int t = (*targets)[i];
+                if (targetMark[t] != generation) {
+                    targetMark[t] = generation;
+                    targetsLeft++;
+                }
+            }
+        }
+
+        dist[src] = 0;
+        parent[src] = -1;
+        reached[src] = generation;
+        pq.insert(src, guided ? g.straightLine(src, dest) : 0);
+
+        while (!pq.isEmpty()) {
+            int u = pq.extractMin();
+            settled[u] = generation;
+            settledCount++;
+            if (verbose) {
+                cout << "  [Engine] Settled " << u << " at " << dist[u] << "\n";
+            }
+            if (u == dest) break;
+            if (targetsLeft > 0 && targetMark[u] == generation && --targetsLeft == 0) break;
+
+            for (int e = g.arcBegin(u); e < g.arcEnd(u); e++) {
+                int v = g.arcDest(e);
+                if (settled[v] == generation) continue;
+
+                int nd = dist[u] + g.arcWeight(e);
+                if (reached[v] != generation || nd < dist[v]) {
+                    reached[v] = generation;
+                    dist[v] = nd;
+                    parent[v] = u;
+                    pq.push(v, guided ? nd + g.straightLine(v, dest) : nd);
+                    if (verbose) {
+                        cout << "  [Engine]   Relaxed " << u << " -> " << v << " = " << nd << "\n";
+                    }
+                }
+            }
+        }
+    }
+
+    // Bidirectional Dijkstra. Each step settles the closer of the two
+    // frontiers. Whenever a relaxation lowers a vertex the other side has
+    // also reached, the route through it is a candidate (best so far = mu).
+    // Once the two smallest heap keys add up to mu or more, no route through
+    // an unsettled vertex can be shorter, so mu is the answer.
+    int searchBidirectional(int src, int dest) {
+        if (!backPq) allocateBackward();
+        const CSRGraph& fwd = graph();
+        const CSRGraph& bwd = reverseGraph();
+        nextGeneration();
+        settledCount = 0;
+
+        dist[src] = 0;
+        parent[src] = -1;
+        reached[src] = generation;
+        pq.insert(src, 0);
+
+        backDist[dest] = 0;
+        backParent[dest] = -1;
+        backReached[dest] = generation;
+        backPq->insert(dest, 0);
+
+        int mu = UNREACHABLE;
+        meetVertex = -1;
+        if (src == dest) {
+            mu = 0;
+            meetVertex = src;
+        }
+
+        while (!pq.isEmpty() && !backPq->isEmpty()) {
+            if ((long long)pq.minKey() + backPq->minKey() >= mu) break;
+
+            bool forward = pq.minKey() <= backPq->minKey();
+            const CSRGraph& g = forward ? fwd : bwd;
+            IndexedHeap<int>& heap = forward ? pq : *backPq;
+            int* d = forward ? dist : backDist;
+            int* p = forward ? parent : backParent;
+            unsigned int* r = forward ? reached : backReached;
+            unsigned int* s = forward ? settled : backSettled;
+            // The other side, to spot meeting points
+            int* otherDist = forward ? backDist : dist;
+            unsigned int* otherReached = forward ? backReached : reached;
+
+            int u = heap.extractMin();
+            s[u] = generation;
+            settledCount++;
+            if (verbose) {
+                cout << "  [Engine] " << (forward ? "Forward" : "Backward")
+                     << " settled " << u << " at " << d[u] << "\n";
+            }
+
+            for (int e = g.arcBegin(u); e < g.arcEnd(u); e++) {
+                int v = g.arcDest(e);
+                if (s[v] == generation) continue;
+
+                int nd = d[u] + g.arcWeight(e);
+                if (r[v] == generation && nd >= d[v]) continue;
+
+                r[v] = generation;
+                d[v] = nd;
+                p[v] = u;
+                heap.push(v, nd);
+                if (verbose) {
+                    cout << "  [Engine]   Relaxed " << u << " -> " << v << " = " << nd << "\n";
+                }
+
+                if (otherReached[v] == generation && (long long)nd + otherDist[v] < mu) {
+                    mu = nd + otherDist[v];
+                    meetVertex = v;
+                    if (verbose) {
+                        cout << "  [Engine]   Frontiers meet at " << v << ", route " << mu << "\n";
+                    }
+                }
+            }
+        }
+        return mu;
+    }
+
+    // Run the query for the current mode; returns the distance
+    int run(int src, int dest) {
+        if (mode == BIDIRECTIONAL) return searchBidirectional(src, dest);
+        search(src, dest, mode == ASTAR);
+        return treeDistance(dest);
+    }
+
+    bool validVertex(int v) const {
+        return v >= 0 && v < numVertices;
+    }
+
+public:
+    // The graph must outlive the engine
+    explicit ShortestPathEngine(Graph& g)
+        : source(&g), fixed(nullptr), numVertices(g.getNumVertices()),
+          pq(g.getNumVertices()), verbose(false), mode(DIJKSTRA),
+          settledCount(0), meetVertex(-1) {
+        allocate();
+    }
+
+    explicit ShortestPathEngine(const CSRGraph& g)
+        : source(nullptr), fixed(&g), numVertices(g.getNumVertices()),
+          pq(g.getNumVertices()), verbose(false), mode(DIJKSTRA),
+          settledCount(0), meetVertex(-1) {
+        allocate();
+    }
+
+    ~ShortestPathEngine() {
+        delete[] dist;
+        delete[] parent;
+        delete[] reached;
+        delete[] settled;
+        delete[] backDist;
+        delete[] backParent;
+        delete[] backReached;
+        delete[] backSettled;
+        delete backPq;
+        delete[] targetMark;
+        delete reverse;
+    }
+
+    ShortestPathEngine(const ShortestPathEngine&) = delete;
+    ShortestPathEngine& operator=(const ShortestPathEngine&) = delete;
+
+    // Print every settle/relax step to cout (off by default)
+    void setVerbose(bool on) {
+        verbose = on;
+    }
+
+    bool isVerbose() const {
+        return verbose;
+    }
+
+    // Search used by distance/findRoute. ASTAR falls back to plain
+    // Dijkstra if the graph has no positions.
+    void setMode(Mode m) {
+        mode = m;
+    }
+
+    Mode getMode() const {
+        return mode;
+    }
+
+    // How many vertices the last query settled, for comparing search modes
+    int lastSettledCount() const {
+        return settledCount;
+    }
+
+    // Full shortest-path tree from src; read it with treeDistance/treeParent
+    void solveFrom(int src) {
+        if (!validVertex(src)) {
+            Display::printError("Invalid vertex index");
+            return;
+        }
+        search(src, -1, false);
+    }
+
+    // Like solveFrom, but stops as soon as every target is settled
+    void solveTo(int src, const vector<int>& targets) {
+        if (!validVertex(src)) {
+            Display::printError("Invalid vertex index");
+            return;
+        }
+        for (size_t i = 0; i < targets.size(); i++) {
+            if (!validVertex(targets[i])) {
+                Display::printError("Invalid vertex index");
+                return;
+            }
+        }
+        search(src, -1, false, &targets);
+    }
+
+    // Results of the last one-directional search, valid for vertices it settled
+    int treeDistance(int v) const {
+        return settled[v] == generation ? dist[v] : UNREACHABLE;
+    }
+
+    int treeParent(int v) const {
+        return settled[v] == generation ? parent[v] : -1;
+    }
+
+    // Shortest distance only; UNREACHABLE if there is no route
+    int distance(int src, int dest) {
+        if (!validVertex(src) || !validVertex(dest)) {
+            Display::printError("Invalid vertex index");
+            return UNREACHABLE;
+        }
+        return run(src, dest);
+    }
+
+    // Fills out with the distance and path; reuses out.path's storage, so a
+    // caller looping over many queries can keep one RouteResult around
+    bool findRoute(int src, int dest, RouteResult& out) {
+        out.path.clear();
+        out.distance = distance(src, dest);
+        if (out.distance == UNREACHABLE) return false;
+
+        // src .. meetVertex: the forward parent chain, flipped in place
+        for (int v = meetVertex; v != -1; v = parent[v]) {
+            out.path.push_back(v);
+        }
+        for (size_t i = 0, j = out.path.size() - 1; i < j; i++, j--) {
+            int tmp = out.path[i];
+            out.path[i] = out.path[j];
+            out.path[j] = tmp;
+        }
+        // meetVertex .. dest: the backward parent chain, already in order
+        if (mode == BIDIRECTIONAL) {
+            for (int v = backParent[meetVertex]; v != -1; v = backParent[v]) {
+                out.path.push_back(v);
+            }
+        }
+        return true;
+    }
+
+    RouteResult findRoute(int src, int dest) {
+        RouteResult result;
+        findRoute(src, dest, result);
+        return result;
+    }
+
+    int getNumVertices() const {
+        return numVertices;
+    }
+};
+
+#endif
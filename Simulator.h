@@ -0,0 +1,466 @@
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "ContractionHierarchy.h"
+#include "DeliveryManager.h"
+#include "Display.h"
+#include "Graph.h"
+#include "Heap.h"
+#include "OrderManager.h"
+#include "Queue.h"
+#include "RestaurantManager.h"
+#include "Sorting.h"
+
+using namespace std;
+
+// ============================================================================
+// DELIVERY SIMULATOR - Headless discrete-event run of a whole day
+// ============================================================================
+// Time only moves from one event to the next: a min-heap of events keyed on
+// simulated minutes is popped in order, and handling an event schedules the
+// ones it causes. Nothing happens between events, so a quiet night costs as
+// little as a busy lunch hour, and a full day is simulated in seconds.
+//
+//   ORDER_PLACED  a customer a random walk of a few streets away from a
+//                 random restaurant orders from it. The order goes through the
+//                 OrderManager into the restaurant's pendingOrders queue,
+//                 and the free agent closest to the restaurant is sent.
+//   FOOD_READY    the kitchen (cooksPerRestaurant orders at once, FIFO)
+//                 finished an order and starts the next one.
+//   AGENT_AT_RESTAURANT
+//                 the agent waits there until the food is ready.
+//   DELIVERED     the agent is free again at the customer and takes the
+//                 oldest order that is still waiting for an agent.
+//
+// Arrivals follow a daily curve with lunch and dinner peaks (a Poisson
+// process whose rate changes over the day). Travel time is road distance
+// from the ContractionHierarchy divided by the agent speed. All Display
+// output is switched off while run() works.
+
+enum SimulationEventType {
+    ORDER_PLACED,
+    FOOD_READY,
+    AGENT_AT_RESTAURANT,
+    DELIVERED
+};
+
+struct SimulationEvent {
+    double time;
+    long long seq;   // Breaks ties in the order events were scheduled
+    int type;
+    int job;
+
+    SimulationEvent(double t, long long s, int type, int job) : time(t), seq(s), type(type), job(job) {}
+    SimulationEvent() : time(0), seq(0), type(ORDER_PLACED), job(-1) {}
+
+    bool operator<(const SimulationEvent& other) const {
+        if (time != other.time) return time < other.time;
+        return seq < other.seq;
+    }
+};
+
+struct SimulationConfig {
+    int restaurants;
+    int cooksPerRestaurant;   // Orders a kitchen prepares at the same time
+    int agents;
+    double ordersPerDay;      // Expected arrivals over dayMinutes
+    double dayMinutes;        // Orders stop after this; deliveries finish
+    double prepMinutes;       // Mean kitchen time per order
+    double prepMinimum;       // Kitchen time never drops below this
+    double distancePerMinute; // Road weight units an agent covers per minute
+    int customerWalk;         // Length of the random walk to the customer, in arcs
+    unsigned seed;
+
+    SimulationConfig()
+        : restaurants(200), cooksPerRestaurant(3), agents(300), ordersPerDay(20000),
+          dayMinutes(1440), prepMinutes(12), prepMinimum(4), distancePerMinute(0.5),
+          customerWalk(60), seed(1) {}
+};
+
+struct SimulationReport {
+    int ordersPlaced;
+    int ordersDelivered;
+    int ordersUnroutable;     // Placed, but the customer or agent has no road to the restaurant
+    int maxWaiting;           // Most orders waiting for an agent at once
+    long long events;
+    double lastDelivery;      // Simulated minute of the last delivery
+    double ordersPerHour;     // Deliveries per hour until the last one (or the day's end)
+    double peakOrdersPerHour; // Busiest clock hour
+    double latencyMean;       // Minutes from order to door
+    double latencyP50, latencyP90, latencyP99;
+    double agentWaitMean;     // Minutes from order until an agent is sent
+    double utilisation;       // Share of agent time spent driving or waiting at a kitchen
+    double distancePerOrder;  // Road weight units driven per delivery
+    double setupSeconds;      // Wall time spent building managers and the hierarchy
+    double runSeconds;        // Wall time of the event loop
+
+    SimulationReport()
+        : ordersPlaced(0), ordersDelivered(0), ordersUnroutable(0), maxWaiting(0), events(0),
+          lastDelivery(0), ordersPerHour(0), peakOrdersPerHour(0), latencyMean(0),
+          latencyP50(0), latencyP90(0), latencyP99(0), agentWaitMean(0), utilisation(0),
+          distancePerOrder(0), setupSeconds(0), runSeconds(0) {}
+
+    void print() const {
+        cout << "Orders placed:      " << ordersPlaced << "\n";
+        cout << "Orders delivered:   " << ordersDelivered << "\n";
+        cout << "Unroutable:         " << ordersUnroutable << "\n";
+        cout << "Throughput:         " << ordersPerHour << " orders/hour (peak " << peakOrdersPerHour << ")\n";
+        cout << "Latency (min):      mean " << latencyMean << ", p50 " << latencyP50
+             << ", p90 " << latencyP90 << ", p99 " << latencyP99 << "\n";
+        cout << "Wait for agent:     " << agentWaitMean << " min (max queue " << maxWaiting << ")\n";
+        cout << "Agent utilisation:  " << utilisation * 100 << "%\n";
+        cout << "Distance per order: " << distancePerOrder << "\n";
+        cout << "Events:             " << events << " (last delivery at minute " << lastDelivery << ")\n";
+        cout << "Wall time:          " << setupSeconds << " s setup, " << runSeconds << " s simulation\n";
+    }
+};
+
+class DeliverySimulator {
+private:
+    // One order as the simulator tracks it; the job index is its order ID
+    struct Job {
+        int restaurant;
+        int customer;         // Map vertex
+        int deliveryLeg;      // Road distance restaurant -> customer
+        double placed;
+        double dispatched;    // -1 until an agent is sent
+        double ready;         // -1 until the kitchen is done
+        bool agentThere;
+        DeliveryAgent* agent;
+    };
+
+    // Everything one run() touches
+    struct State {
+        OrderManager orders;
+        RestaurantManager restaurants;
+        DeliveryManager agents;
+        vector<int> restaurantVertex;
+        vector<int> cooking;          // Orders on each restaurant's stoves
+        vector<Job> jobs;
+        Queue<int> waiting;           // Jobs with no agent yet, oldest first
+        Heap<SimulationEvent, 4> events;
+        long long nextSeq;
+        mt19937 rng;
+
+        double busyMinutes;
+        double agentWaitTotal;
+        double distanceTotal;
+        vector<double> latencies;
+        vector<int> perHour;
+
+        State(unsigned seed, double gridCell)
+            : agents(gridCell), events(1024), nextSeq(0), rng(seed), busyMinutes(0),
+              agentWaitTotal(0), distanceTotal(0) {}
+    };
+
+    Graph* graph;            // Set when built from an editable Graph
+    const CSRGraph* map;     // Its current CSR snapshot, taken in run()
+    ContractionHierarchy* routes;
+    SimulationConfig config;
+
+    // Relative order rate at minute t of the day: lunch and dinner peaks
+    // over a small base rate
+    static double demandCurve(double t) {
+        double m = fmod(t, 1440.0);
+        double lunch = (m - 13 * 60) / 75.0;
+        double dinner = (m - 20 * 60) / 90.0;
+        return 0.3 + exp(-0.5 * lunch * lunch) + 1.4 * exp(-0.5 * dinner * dinner);
+    }
+
+    // AgentGrid cells about big enough for two agents each if the agents
+    // were spread over the map, in whatever units its coordinates use
+    double gridCellSize() const {
+        int V = map->getNumVertices();
+        double minX = 0, minY = 0, maxX = 0, maxY = 0;
+        for (int v = 0; v < V; v++) {
+            double x, y;
+            if (!map->getPosition(v, x, y)) return 2.0;
+            if (v == 0 || x < minX) minX = x;
+            if (v == 0 || x > maxX) maxX = x;
+            if (v == 0 || y < minY) minY = y;
+            if (v == 0 || y > maxY) maxY = y;
+        }
+        double span = maxX - minX > maxY - minY ? maxX - minX : maxY - minY;
+        if (span <= 0) return 2.0;
+        double area = (maxX - minX) * (maxY - minY);
+        if (area <= 0) area = span * span / config.agents; // Points on a line
+        return sqrt(2.0 * area / config.agents);
+    }
+
+    void schedule(State& s, double time, int type, int job) {
+        s.events.insert(SimulationEvent(time, s.nextSeq++, type, job));
+    }
+
+    double uniform(State& s) {
+        return uniform_real_distribution<double>(0.0, 1.0)(s.rng);
+    }
+
+    int randomIndex(State& s, int n) {
+        return uniform_int_distribution<int>(0, n - 1)(s.rng);
+    }
+
+    Order makeOrder(const State& s, int j) const {
+        Order o(to_string(j), "C" + to_string(s.jobs[j].customer), "R" + to_string(s.jobs[j].restaurant));
+        o.deliverySector = s.jobs[j].customer;
+        return o;
+    }
+
+    // Thinning: candidates at the peak rate, each kept with probability
+    // rate(t) / peak rate
+    void scheduleArrival(State& s, double now, double peakRate, double scale) {
+        double t = now;
+        for (;;) {
+            t += exponential_distribution<double>(peakRate)(s.rng);
+            if (t >= config.dayMinutes) return;
+            if (uniform(s) * peakRate <= scale * demandCurve(t)) break;
+        }
+        schedule(s, t, ORDER_PLACED, -1);
+    }
+
+    void placeOrder(State& s, double now, SimulationReport& report) {
+        int restaurant = randomIndex(s, (int)s.restaurantVertex.size());
+        int customer = s.restaurantVertex[restaurant];
+        for (int step = 0; step < config.customerWalk; step++) {
+            int degree = map->degree(customer);
+            if (degree == 0) break;
+            customer = map->arcDest(map->arcBegin(customer) + randomIndex(s, degree));
+        }
+        report.ordersPlaced++;
+        int leg = routes->distance(s.restaurantVertex[restaurant], customer);
+        if (leg == ContractionHierarchy::UNREACHABLE) {
+            report.ordersUnroutable++;
+            return;
+        }
+
+        Job job;
+        job.restaurant = restaurant;
+        job.customer = customer;
+        job.deliveryLeg = leg;
+        job.placed = now;
+        job.dispatched = -1;
+        job.ready = -1;
+        job.agentThere = false;
+        job.agent = nullptr;
+        s.jobs.push_back(job);
+        s.orders.placeOrder(makeOrder(s, (int)s.jobs.size() - 1));
+
+        // The restaurant accepts everything the OrderManager has queued
+        Order o;
+        while (s.orders.tryGetNextOrder(o)) {
+            int j = atoi(o.orderID.c_str());
+            Restaurant* r = s.restaurants.getRestaurantAt(s.jobs[j].restaurant);
+            r->addOrder(std::move(o));
+            startCooking(s, now, s.jobs[j].restaurant);
+            s.waiting.enqueue(j);
+        }
+        sendAgents(s, now, report);
+    }
+
+    void startCooking(State& s, double now, int r) {
+        Restaurant* restaurant = s.restaurants.getRestaurantAt(r);
+        while (s.cooking[r] < config.cooksPerRestaurant && !restaurant->pendingOrders.isEmpty()) {
+            Order o = restaurant->processNextOrder();
+            double prep = config.prepMinimum
+                        + exponential_distribution<double>(1.0 / (config.prepMinutes - config.prepMinimum))(s.rng);
+            s.cooking[r]++;
+            schedule(s, now + prep, FOOD_READY, atoi(o.orderID.c_str()));
+        }
+    }
+
+    // Give waiting orders, oldest first, the closest free agent
+    void sendAgents(State& s, double now, SimulationReport& report) {
+        while (!s.waiting.isEmpty() && s.agents.countAvailable() > 0) {
+            int j;
+            s.waiting.dequeue(j);
+            Job& job = s.jobs[j];
+            int pickup = s.restaurantVertex[job.restaurant];
+            double x = 0, y = 0;
+            map->getPosition(pickup, x, y);
+            DeliveryAgent* agent = map->hasPositions() ? s.agents.assignAgent(makeOrder(s, j), x, y)
+                                                       : s.agents.assignAgent(makeOrder(s, j));
+            if (!agent) break;
+            int leg = routes->distance(agent->getSector(), pickup);
+            if (leg == ContractionHierarchy::UNREACHABLE) {
+                // The restaurant still cooks it, but nobody will come
+                s.agents.completeDelivery(agent->id);
+                report.ordersUnroutable++;
+                continue;
+            }
+            job.agent = agent;
+            job.dispatched = now;
+            s.agentWaitTotal += now - job.placed;
+            s.distanceTotal += leg;
+            schedule(s, now + leg / config.distancePerMinute, AGENT_AT_RESTAURANT, j);
+        }
+        if (s.waiting.size() > report.maxWaiting) report.maxWaiting = s.waiting.size();
+    }
+
+    // Through the DeliveryManager, so a free agent stays indexed where
+    // they stand; maps without coordinates only track the vertex
+    void moveAgent(State& s, DeliveryAgent* agent, int v) {
+        double x, y;
+        if (map->getPosition(v, x, y)) s.agents.moveAgent(agent, v, x, y);
+        else s.agents.moveAgent(agent, v);
+    }
+
+    void pickUp(State& s, double now, int j) {
+        Job& job = s.jobs[j];
+        s.distanceTotal += job.deliveryLeg;
+        schedule(s, now + job.deliveryLeg / config.distancePerMinute, DELIVERED, j);
+    }
+
+    void handle(State& s, const SimulationEvent& e, double peakRate, double scale, SimulationReport& report) {
+        switch (e.type) {
+            case ORDER_PLACED:
+                placeOrder(s, e.time, report);
+                scheduleArrival(s, e.time, peakRate, scale);
+                break;
+
+            case FOOD_READY: {
+                Job& job = s.jobs[e.job];
+                job.ready = e.time;
+                s.cooking[job.restaurant]--;
+                startCooking(s, e.time, job.restaurant);
+                if (job.agentThere) pickUp(s, e.time, e.job);
+                break;
+            }
+
+            case AGENT_AT_RESTAURANT: {
+                Job& job = s.jobs[e.job];
+                moveAgent(s, job.agent, s.restaurantVertex[job.restaurant]);
+                job.agentThere = true;
+                if (job.ready >= 0) pickUp(s, e.time, e.job);
+                break;
+            }
+
+            case DELIVERED: {
+                Job& job = s.jobs[e.job];
+                moveAgent(s, job.agent, job.customer);
+                s.agents.completeDelivery(job.agent->id);
+                s.busyMinutes += e.time - job.dispatched;
+                s.latencies.push_back(e.time - job.placed);
+                int hour = (int)(e.time / 60);
+                if (hour >= (int)s.perHour.size()) s.perHour.resize(hour + 1, 0);
+                s.perHour[hour]++;
+                report.ordersDelivered++;
+                report.lastDelivery = e.time;
+                sendAgents(s, e.time, report);
+                break;
+            }
+        }
+    }
+
+    static double percentile(const vector<double>& sorted, double p) {
+        if (sorted.empty()) return 0;
+        size_t i = (size_t)ceil(p * sorted.size());
+        if (i > 0) i--;
+        return sorted[i < sorted.size() ? i : sorted.size() - 1];
+    }
+
+    static double secondsSince(chrono::steady_clock::time_point start) {
+        return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    }
+
+public:
+    // The hierarchy must be built for this map (it is built here if it is
+    // not); both must outlive the simulator
+    DeliverySimulator(const CSRGraph& g, ContractionHierarchy& ch, const SimulationConfig& cfg = SimulationConfig())
+        : graph(nullptr), map(&g), routes(&ch), config(cfg) {}
+
+    // The Graph may change between runs; each run() uses it as it is then
+    DeliverySimulator(Graph& g, ContractionHierarchy& ch, const SimulationConfig& cfg = SimulationConfig())
+        : graph(&g), map(nullptr), routes(&ch), config(cfg) {}
+
+    void setConfig(const SimulationConfig& cfg) {
+        config = cfg;
+    }
+
+    const SimulationConfig& getConfig() const {
+        return config;
+    }
+
+    // Simulate one day from scratch; returns an empty report if the
+    // configuration cannot run
+    SimulationReport run() {
+        SimulationReport report;
+        if (graph) map = &graph->csr(); // An edit since the last run replaced the snapshot
+        int V = map->getNumVertices();
+        if (V == 0 || config.restaurants <= 0 || config.agents <= 0 || config.ordersPerDay <= 0
+            || config.dayMinutes <= 0 || config.distancePerMinute <= 0 || config.cooksPerRestaurant <= 0
+            || config.prepMinutes <= config.prepMinimum) {
+            Display::printError("Invalid simulation settings");
+            return report;
+        }
+
+        DisplaySink* previous = &Display::sink();
+        Display::useNullBackend();
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+        if (!routes->matches(*map)) routes->build(*map);
+
+        State s(config.seed, gridCellSize());
+        for (int r = 0; r < config.restaurants; r++) {
+            int v = randomIndex(s, V);
+            s.restaurants.addRestaurant("R" + to_string(r), "Kitchen " + to_string(r), "Simulated", 4.0, v);
+            s.restaurantVertex.push_back(v);
+        }
+        s.cooking.assign(config.restaurants, 0);
+        for (int a = 0; a < config.agents; a++) {
+            string id = "A" + to_string(a);
+            s.agents.addAgent(id, "Rider " + to_string(a), "-");
+            moveAgent(s, s.agents.getAgent(id), randomIndex(s, V));
+        }
+        s.jobs.reserve((size_t)(config.ordersPerDay * 1.1));
+        s.latencies.reserve((size_t)(config.ordersPerDay * 1.1));
+
+        // Scale the curve so the day holds ordersPerDay orders on average
+        double area = 0, peak = 0;
+        for (double t = 0.5; t < config.dayMinutes; t += 1.0) {
+            double c = demandCurve(t);
+            area += c;
+            if (c > peak) peak = c;
+        }
+        double scale = config.ordersPerDay / area;
+        double peakRate = scale * peak * 1.01;
+        report.setupSeconds = secondsSince(start);
+
+        start = chrono::steady_clock::now();
+        scheduleArrival(s, 0, peakRate, scale);
+        while (!s.events.isEmpty()) {
+            SimulationEvent e = s.events.extractMin();
+            report.events++;
+            handle(s, e, peakRate, scale, report);
+        }
+        report.runSeconds = secondsSince(start);
+        Display::setSink(previous);
+
+        int delivered = report.ordersDelivered;
+        if (delivered > 0) {
+            Sorting<double>::mergeSort(&s.latencies[0], delivered);
+            double sum = 0;
+            for (int i = 0; i < delivered; i++) sum += s.latencies[i];
+            report.latencyMean = sum / delivered;
+            report.latencyP50 = percentile(s.latencies, 0.50);
+            report.latencyP90 = percentile(s.latencies, 0.90);
+            report.latencyP99 = percentile(s.latencies, 0.99);
+            report.agentWaitMean = s.agentWaitTotal / delivered;
+            report.distancePerOrder = s.distanceTotal / delivered;
+        }
+        double span = report.lastDelivery > config.dayMinutes ? report.lastDelivery : config.dayMinutes;
+        report.ordersPerHour = delivered / (span / 60.0);
+        for (size_t h = 0; h < s.perHour.size(); h++) {
+            if (s.perHour[h] > report.peakOrdersPerHour) report.peakOrdersPerHour = s.perHour[h];
+        }
+        report.utilisation = s.busyMinutes / (span * config.agents);
+        return report;
+    }
+};
+
+#endif
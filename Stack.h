@@ -1,59 +1,106 @@
-#ifndef STACK_H
-#define STACK_H
-
-#include "LinkedList.h"
-
-template <typename T>
-class Stack {
-private:
-    Node<T>* top;
-    int count;
-
-public:
-    Stack() : top(nullptr), count(0) {}
-
-    ~Stack() {
-        while (!isEmpty()) {
-            pop();
-        }
-    }
-
-    void push(T val) {
-        Node<T>* newNode = new Node<T>(val);
-        newNode->next = top;
-        top = newNode;
-        count++;
-    }
-
-    void pop() {
-        if (isEmpty()) {
-            Display::printError("Stack Underflow");
-            return;
-        }
-        Node<T>* temp = top;
-        top = top->next;
-        delete temp;
-        count--;
-    }
-
-    T peek() const {
-        if (isEmpty()) {
-            // Depending on T, returning a default constructed object or throwing exception
-            // For simplicity in this project, assuming caller checks isEmpty()
-            // or returning a dummy value if T allows. 
-            // Ideally should throw, but let's just return T() for now or handle carefully.
-            return T(); 
-        }
-        return top->data;
-    }
-
-    bool isEmpty() const {
-        return top == nullptr;
-    }
-
-    int size() const {
-        return count;
-    }
-};
-
-#endif
+#ifndef STACK_H
+#define STACK_H
+
+#include "LinkedList.h"
+
+template <typename T>
+class Stack {
+private:
+    Node<T>* top;
+    int count;
+
+    T& link(Node<T>* newNode) {
+        newNode->next = top;
+        top = newNode;
+        count++;
+        return newNode->data;
+    }
+
+public:
+    Stack() : top(nullptr), count(0) {}
+
+    ~Stack() {
+        while (!isEmpty()) {
+            pop();
+        }
+    }
+
+    // Copy Constructor - deep copy that keeps the same top-to-bottom order
+    Stack(const Stack& other) : top(nullptr), count(0) {
+        Node<T>** slot = &top;
+        for (Node<T>* temp = other.top; temp; temp = temp->next) {
+            *slot = new Node<T>(temp->data);
+            slot = &(*slot)->next;
+            count++;
+        }
+    }
+
+    // Move Constructor - steals the nodes
+    Stack(Stack&& other) noexcept : top(other.top), count(other.count) {
+        other.top = nullptr;
+        other.count = 0;
+    }
+
+    Stack& operator=(Stack other) noexcept {
+        swap(top, other.top);
+        swap(count, other.count);
+        return *this;
+    }
+
+    void push(const T& val) {
+        link(new Node<T>(val));
+    }
+
+    void push(T&& val) {
+        link(new Node<T>(std::move(val)));
+    }
+
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        return link(new Node<T>(in_place, std::forward<Args>(args)...));
+    }
+
+    void pop() {
+        if (isEmpty()) {
+            Display::printError("Stack Underflow");
+            return;
+        }
+        Node<T>* temp = top;
+        top = top->next;
+        delete temp;
+        count--;
+    }
+
+    // Move the top element into out and remove it
+    bool pop(T& out) {
+        if (isEmpty()) return false;
+        out = std::move(top->data);
+        pop();
+        return true;
+    }
+
+    // Caller should check isEmpty
+    T& peek() {
+        if (isEmpty()) {
+            throw out_of_range("Stack is empty");
+        }
+        return top->data;
+    }
+
+    const T& peek() const {
+        if (isEmpty()) {
+            throw out_of_range("Stack is empty");
+        }
+        return top->data;
+    }
+
+    bool isEmpty() const {
+        return top == nullptr;
+    }
+
+    int size() const {
+        return count;
+    }
+};
+
+#endif
@@ -0,0 +1,373 @@
+// ============================================================================
+// BENCH CONTAINERS - Timings and checks for the core containers
+// ============================================================================
+// Build:  g++ -O2 -std=c++17 -DDISPLAY_NO_DEMO bench_containers.cpp -o bench_containers
+// Usage:  bench_containers [section] [size]
+//
+// Sections (all of them when none is named):
+//   history   append orders to one LinkedList, as OrderManager's history
+//             does; size is the number of orders (default 1M). Time per
+//             append must stay flat as the list grows. Build again with
+//             -DNODEPOOL_DISABLE to time plain new/delete nodes.
+//   placement place 3-item orders the way the customer portal does (global
+//             queue, history, restaurant queue, customer stack) and count
+//             heap allocations per order; the most any one order makes
+//             must stay under MAX_PLACEMENT_ALLOCATIONS.
+//   customers register customers, then log each one in by phone and look
+//             them up by ID in scattered order; size is the number of
+//             customers (default 1M; 10M needs about 3.5 GB of memory).
+//   heap      Heap<int, 2/3/4> against std::priority_queue and IndexedHeap
+//             decrease-key against a sorted reference, then one Dijkstra
+//             over a grid of ~1M roads with each heap; size is the grid
+//             side (default 708).
+//
+// Every section checks its results and the program exits with 1 if one
+// is wrong, so the timings are never of a broken build.
+
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <queue>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include "Customer.h"
+#include "CustomerManager.h"
+#include "Graph.h"
+#include "Heap.h"
+#include "IndexedHeap.h"
+#include "Order.h"
+#include "OrderManager.h"
+#include "Restaurant.h"
+
+using namespace std;
+
+// Every heap allocation in the program comes through here, so sections
+// can count them. Kept out of line: once inlined, GCC pairs these malloc()
+// and free() calls with new and delete expressions and warns of a mismatch.
+#ifdef __GNUC__
+#define OUT_OF_LINE __attribute__((noinline))
+#else
+#define OUT_OF_LINE
+#endif
+
+static long long allocations = 0;
+
+OUT_OF_LINE void* operator new(size_t n) {
+    allocations++;
+    void* p = malloc(n ? n : 1);
+    if (!p) throw bad_alloc();
+    return p;
+}
+
+OUT_OF_LINE void operator delete(void* p) noexcept {
+    free(p);
+}
+
+OUT_OF_LINE void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static bool check(bool ok, const string& what) {
+    if (!ok) cout << "  CHECK FAILED: " << what << endl;
+    return ok;
+}
+
+// ----------------------------------------------------------------------------
+// history: 1M orders appended at the tail
+// ----------------------------------------------------------------------------
+static bool benchHistory(int n) {
+    cout << "History of " << n << " orders (one item each)"
+#ifdef NODEPOOL_DISABLE
+         << ", NodePool disabled"
+#endif
+         << endl;
+    LinkedList<Order> history;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    double lastMark = 0;
+    int lastCount = 0;
+    for (int i = 0; i < n; i++) {
+        Order o("ORD" + to_string(i), "C001", "R001");
+        o.addItem(MenuItem("M001", "Chicken Biryani", 450.0, "Desi"));
+        history.insertTail(std::move(o));
+        if (i + 1 == n / 4 || i + 1 == n / 2 || i + 1 == n) {
+            double t = secondsSince(start);
+            cout << "  " << i + 1 << " orders: " << t * 1000 << " ms ("
+                 << (t - lastMark) * 1e9 / (i + 1 - lastCount) << " ns per append since last mark)" << endl;
+            lastMark = t;
+            lastCount = i + 1;
+        }
+    }
+
+    bool ok = check(history.size() == n, "history size");
+    int i = 0;
+    for (Node<Order>* temp = history.getHead(); ok && temp; temp = temp->next, i++) {
+        ok = check(temp->data.orderID == "ORD" + to_string(i), "orders kept in placement order");
+    }
+    start = chrono::steady_clock::now();
+    history.clear();
+    cout << "  Freeing the list: " << secondsSince(start) * 1000 << " ms" << endl;
+    return ok;
+}
+
+// ----------------------------------------------------------------------------
+// placement: allocations per order placed from the customer portal
+// ----------------------------------------------------------------------------
+// Item names longer than the short-string buffer, so each copy of an item
+// list costs one allocation per name and shows up in the count. Without
+// the NodePool every list node is one more allocation.
+#ifdef NODEPOOL_DISABLE
+static const int MAX_PLACEMENT_ALLOCATIONS = 28;
+#else
+static const int MAX_PLACEMENT_ALLOCATIONS = 16;
+#endif
+
+static bool benchPlacement(int n) {
+    cout << "Placing " << n << " orders of 3 items" << endl;
+    OrderManager om;
+    Restaurant restaurant("R001", "Monal Express", "Pakistani", 4.5);
+    Customer customer("C001", "Ali Khan", "0300-1234567", "F-7");
+
+    long long total = 0, most = 0;
+    for (int i = 0; i < n; i++) {
+        Order order("ORD" + to_string(i), customer.id, restaurant.id);
+        order.addItem(MenuItem("M001", "Chicken Karahi Special Platter", 850.0, "Main"));
+        order.addItem(MenuItem("M002", "Seekh Kebab with Naan and Raita", 450.0, "BBQ"));
+        order.addItem(MenuItem("M003", "Chapli Kebab with Green Chutney", 400.0, "BBQ"));
+
+        // Same three steps as main.cpp's Place Order
+        long long before = allocations;
+        om.placeOrder(order);
+        restaurant.addOrder(order);
+        customer.addOrderToHistory(std::move(order));
+        long long used = allocations - before;
+        total += used;
+        if (used > most) most = used;
+    }
+    cout << "  Allocations per order: " << (double)total / n << " on average, " << most << " at most" << endl;
+
+    bool ok = check(om.totalOrders() == n, "every order reached the history");
+    ok = check(most <= MAX_PLACEMENT_ALLOCATIONS, "at most " + to_string(MAX_PLACEMENT_ALLOCATIONS)
+               + " allocations per order") && ok;
+    return ok;
+}
+
+// ----------------------------------------------------------------------------
+// customers: hash-indexed login and lookup
+// ----------------------------------------------------------------------------
+static bool benchCustomers(int n) {
+    cout << "Customers: " << n << endl;
+    CustomerManager cm;
+    cm.reserve(n);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        cm.registerCustomer("C" + to_string(i), "Customer", "03" + to_string(i), "F-7");
+    }
+    cout << "  Register: " << secondsSince(start) * 1e9 / n << " ns per customer" << endl;
+
+    // Visit customers in a scattered order (7919 is prime, so every one once)
+    bool ok = true;
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        int k = (int)((long long)i * 7919 % n);
+        Customer* c = cm.login("03" + to_string(k));
+        if (!c || c->id != "C" + to_string(k)) ok = false;
+    }
+    cout << "  Login:    " << secondsSince(start) * 1e9 / n << " ns per login" << endl;
+    ok = check(ok, "login by phone finds the right customer");
+
+    start = chrono::steady_clock::now();
+    bool found = true;
+    for (int i = 0; i < n; i++) {
+        int k = (int)((long long)i * 7919 % n);
+        Customer* c = cm.findById("C" + to_string(k));
+        if (!c || c->phone != "03" + to_string(k)) found = false;
+    }
+    cout << "  Find:     " << secondsSince(start) * 1e9 / n << " ns per lookup" << endl;
+    ok = check(found, "lookup by ID finds the right customer") && ok;
+
+    ok = check(cm.size() == n, "customer count") && ok;
+    ok = check(!cm.login("0399-0000000") && !cm.findById("X1"), "unknown phone and ID are not found") && ok;
+    ok = check(!cm.registerCustomer("C0", "Again", "0399-0000001", "G-9")
+               && !cm.registerCustomer("X1", "Again", "030", "G-9"), "duplicate ID and phone are refused") && ok;
+    ok = check(cm.login("030") == cm.login("030"), "login returns the stored customer, not a copy") && ok;
+    return ok;
+}
+
+// ----------------------------------------------------------------------------
+// heap: growable d-ary Heap and IndexedHeap
+// ----------------------------------------------------------------------------
+// Random inserts and extracts, starting from capacity 1 so it must grow
+template <int D>
+static bool checkHeap() {
+    Heap<int, D> heap(1);
+    priority_queue<int, vector<int>, greater<int>> reference;
+    mt19937 rng(D);
+    for (int i = 0; i < 200000; i++) {
+        if (rng() % 3 != 0 || reference.empty()) {
+            int v = (int)(rng() % 1000);
+            heap.insert(v);
+            reference.push(v);
+        } else {
+            if (heap.extractMin() != reference.top()) return false;
+            reference.pop();
+        }
+        if (heap.size() != (int)reference.size()) return false;
+    }
+    return true;
+}
+
+// push (insert or decrease), remove and extractMin against a set of
+// (key, id) pairs
+static bool checkIndexedHeap() {
+    const int ids = 1000;
+    IndexedHeap<int> heap(ids);
+    set<pair<int, int>> reference;
+    vector<int> keyOf(ids, -1);
+    mt19937 rng(11);
+    for (int i = 0; i < 200000; i++) {
+        int id = (int)(rng() % ids);
+        int op = (int)(rng() % 4);
+        if (op < 2) {
+            int key = (int)(rng() % 100000);
+            bool lower = keyOf[id] < 0 || key < keyOf[id];
+            heap.push(id, key);
+            if (lower) {
+                if (keyOf[id] >= 0) reference.erase(make_pair(keyOf[id], id));
+                keyOf[id] = key;
+                reference.insert(make_pair(key, id));
+            }
+        } else if (op == 2) {
+            if (heap.remove(id) != (keyOf[id] >= 0)) return false;
+            if (keyOf[id] >= 0) reference.erase(make_pair(keyOf[id], id));
+            keyOf[id] = -1;
+        } else if (!reference.empty()) {
+            // Ties may come out in any order, so compare keys
+            int key = heap.minKey();
+            int id2 = heap.extractMin();
+            if (key != reference.begin()->first || keyOf[id2] != key) return false;
+            reference.erase(make_pair(key, id2));
+            keyOf[id2] = -1;
+        }
+        if (heap.size() != (int)reference.size()) return false;
+        if (heap.contains(id) != (keyOf[id] >= 0)) return false;
+    }
+    return !heap.contains(-1) && !heap.contains(ids);
+}
+
+static Graph* makeGrid(int side, unsigned seed) {
+    Graph* g = new Graph(side * side);
+    mt19937 rng(seed);
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if (c + 1 < side) g->addEdge(u, u + 1, 1 + (int)(rng() % 9));
+            if (r + 1 < side) g->addEdge(u, u + side, 1 + (int)(rng() % 9));
+        }
+    }
+    return g;
+}
+
+struct Reached {
+    int vertex;
+    int distance;
+
+    Reached(int v = -1, int d = 0) : vertex(v), distance(d) {}
+
+    bool operator<(const Reached& other) const {
+        return distance < other.distance;
+    }
+};
+
+// Dijkstra with duplicate heap entries, as before IndexedHeap
+static long long lazyDijkstra(const CSRGraph& g, int src) {
+    int V = g.getNumVertices();
+    vector<int> dist(V, INT_MAX);
+    vector<char> done(V, 0);
+    Heap<Reached> heap;
+    dist[src] = 0;
+    heap.insert(Reached(src, 0));
+    long long sum = 0;
+    while (!heap.isEmpty()) {
+        int u = heap.extractMin().vertex;
+        if (done[u]) continue;
+        done[u] = 1;
+        sum += dist[u];
+        for (int e = g.arcBegin(u); e < g.arcEnd(u); e++) {
+            int v = g.arcDest(e);
+            if (dist[u] + g.arcWeight(e) < dist[v]) {
+                dist[v] = dist[u] + g.arcWeight(e);
+                heap.insert(Reached(v, dist[v]));
+            }
+        }
+    }
+    return sum;
+}
+
+// Each vertex in the heap at most once
+template <int D>
+static long long indexedDijkstra(const CSRGraph& g, int src) {
+    int V = g.getNumVertices();
+    vector<int> dist(V, INT_MAX);
+    IndexedHeap<int, D> heap(V);
+    dist[src] = 0;
+    heap.insert(src, 0);
+    long long sum = 0;
+    while (!heap.isEmpty()) {
+        int u = heap.extractMin();
+        sum += dist[u];
+        for (int e = g.arcBegin(u); e < g.arcEnd(u); e++) {
+            int v = g.arcDest(e);
+            if (dist[u] + g.arcWeight(e) < dist[v]) {
+                dist[v] = dist[u] + g.arcWeight(e);
+                heap.push(v, dist[v]);
+            }
+        }
+    }
+    return sum;
+}
+
+static bool benchHeap(int side) {
+    bool ok = check(checkHeap<2>() && checkHeap<3>() && checkHeap<4>(), "Heap<int, 2/3/4> matches std::priority_queue");
+    ok = check(checkIndexedHeap(), "IndexedHeap matches the reference set") && ok;
+
+    Graph* g = makeGrid(side, 7);
+    const CSRGraph& csr = g->csr();
+    cout << "Dijkstra on a " << side << " x " << side << " grid (" << csr.getNumArcs() / 2 << " roads)" << endl;
+    long long sums[3];
+    const char* names[3] = {"Heap, duplicate entries", "IndexedHeap, 2-ary", "IndexedHeap, 4-ary"};
+    for (int k = 0; k < 3; k++) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        sums[k] = k == 0 ? lazyDijkstra(csr, 0) : k == 1 ? indexedDijkstra<2>(csr, 0) : indexedDijkstra<4>(csr, 0);
+        cout << "  " << names[k] << ": " << secondsSince(start) * 1000 << " ms" << endl;
+    }
+    ok = check(sums[0] == sums[1] && sums[0] == sums[2], "all heaps give the same distances") && ok;
+    delete g;
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    string section = argc > 1 ? argv[1] : "all";
+    int size = argc > 2 ? atoi(argv[2]) : 0;
+    if (section != "all" && section != "history" && section != "placement" && section != "customers"
+        && section != "heap") {
+        cout << "Usage: " << argv[0] << " [history|placement|customers|heap] [size]" << endl;
+        return 1;
+    }
+    Display::useNullBackend();
+
+    bool ok = true;
+    if (section == "all" || section == "history") ok = benchHistory(size > 0 ? size : 1000000) && ok;
+    if (section == "all" || section == "placement") ok = benchPlacement(size > 0 ? size : 10000) && ok;
+    if (section == "all" || section == "customers") ok = benchCustomers(size > 0 ? size : 1000000) && ok;
+    if (section == "all" || section == "heap") ok = benchHeap(size > 1 ? size : 708) && ok;
+    cout << (ok ? "All checks passed" : "Some checks FAILED") << endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,292 @@
+// ============================================================================
+// BENCH DISPATCH - Timings and checks for choosing delivery agents
+// ============================================================================
+// Build:  g++ -O2 -std=c++17 -DDISPLAY_NO_DEMO bench_dispatch.cpp -o bench_dispatch
+// Usage:  bench_dispatch [section] [size]
+//
+// Sections (all of them when none is named):
+//   nearest   DeliveryManager::getNearestAgent against scanning every agent,
+//             with size agents (default 50k) spread over 60 x 60 km and
+//             all, 10% and 1% of them free; 100k pickup points each. Grid
+//             cells are sized as Simulator does, from the area per agent.
+//             Both must find an agent at the same distance, also with
+//             positions in metres, where the grid gives up and the free
+//             list is scanned instead.
+//   assign    AssignmentSolver: Hungarian against auction on batches of n
+//             orders and n or 3n agents, costs in metres between random
+//             points of 60 x 60 km, for n up to size (default 1000). Both
+//             must reach the same total cost and a valid matching, and on
+//             small random tables (some cells FORBIDDEN, more orders than
+//             agents and the reverse) the same total as trying every
+//             matching.
+//
+// Every section checks its results and the program exits with 1 if one
+// is wrong, so the timings are never of a broken build.
+
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "AssignmentSolver.h"
+#include "DeliveryAgent.h"
+#include "DeliveryManager.h"
+#include "Order.h"
+
+using namespace std;
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static bool check(bool ok, const string& what) {
+    if (!ok) cout << "  CHECK FAILED: " << what << endl;
+    return ok;
+}
+
+// ----------------------------------------------------------------------------
+// nearest: agent grid against a scan of every agent
+// ----------------------------------------------------------------------------
+static double distanceSq(const DeliveryAgent* a, double x, double y) {
+    if (!a) return -1;
+    double dx = a->getX() - x, dy = a->getY() - y;
+    return dx * dx + dy * dy;
+}
+
+// What finding the closest free agent costs without an index
+static DeliveryAgent* scanAll(const vector<DeliveryAgent*>& agents, double x, double y) {
+    DeliveryAgent* best = nullptr;
+    double bestSq = 0;
+    for (size_t i = 0; i < agents.size(); i++) {
+        DeliveryAgent* a = agents[i];
+        if (!a->isAvailable() || !a->hasPosition()) continue;
+        double d = distanceSq(a, x, y);
+        if (!best || d < bestSq) {
+            best = a;
+            bestSq = d;
+        }
+    }
+    return best;
+}
+
+// Adds count agents at random points of a side x side square
+static vector<DeliveryAgent*> addAgents(DeliveryManager& dm, int count, double side, mt19937& rng) {
+    uniform_real_distribution<double> coord(0, side);
+    vector<DeliveryAgent*> agents;
+    agents.reserve(count);
+    for (int i = 0; i < count; i++) {
+        string id = "A" + to_string(i);
+        dm.addAgent(id, "Agent " + to_string(i), "0300" + to_string(i), 0, coord(rng), coord(rng));
+        agents.push_back(dm.getAgent(id));
+    }
+    return agents;
+}
+
+// Times queries pickups with the grid and with a full scan; false if any
+// answer is farther than the scan's
+static bool compareNearest(DeliveryManager& dm, const vector<DeliveryAgent*>& agents, double side,
+                           int queries, mt19937& rng, const string& label) {
+    uniform_real_distribution<double> coord(0, side);
+    vector<double> xs(queries), ys(queries);
+    for (int q = 0; q < queries; q++) {
+        xs[q] = coord(rng);
+        ys[q] = coord(rng);
+    }
+    vector<DeliveryAgent*> fromGrid(queries);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++) fromGrid[q] = dm.getNearestAgent(xs[q], ys[q]);
+    double gridTime = secondsSince(start);
+
+    // The scan is slow, so it only runs on a sample when there are many queries
+    int scans = queries < 2000 ? queries : 2000;
+    bool same = true;
+    start = chrono::steady_clock::now();
+    for (int q = 0; q < scans; q++) {
+        DeliveryAgent* expected = scanAll(agents, xs[q], ys[q]);
+        if (distanceSq(fromGrid[q], xs[q], ys[q]) != distanceSq(expected, xs[q], ys[q])) same = false;
+    }
+    double scanTime = secondsSince(start);
+    cout << "  " << label << ": grid " << gridTime * 1e6 / queries << " us, scan "
+         << scanTime * 1e6 / scans << " us per query" << endl;
+    return same;
+}
+
+static bool benchNearest(int count) {
+    const double side = 60.0;
+    const int queries = 100000;
+    // As Simulator::gridCellSize: about two agents per cell
+    double cell = sqrt(2 * side * side / count);
+    cout << "Nearest free agent among " << count << " over " << side << " x " << side
+         << " km, cells of " << cell << " km" << endl;
+
+    DeliveryManager dm(cell);
+    mt19937 rng(31);
+    vector<DeliveryAgent*> agents = addAgents(dm, count, side, rng);
+    bool ok = check(compareNearest(dm, agents, side, queries, rng, "all free"),
+                    "grid matches the scan with every agent free");
+
+    // Busy agents leave the grid; the first 90%, then 99%, take an order
+    int busy = 0;
+    const int percentFree[2] = {10, 1};
+    for (int k = 0; k < 2; k++) {
+        int target = count - count * percentFree[k] / 100;
+        for (; busy < target; busy++) {
+            dm.assignTo(agents[busy], Order("O" + to_string(busy), "C1", "R1"));
+        }
+        string label = to_string(dm.countAvailable()) + " free";
+        ok = check(compareNearest(dm, agents, side, queries, rng, label),
+                   "grid matches the scan with " + label) && ok;
+    }
+
+    // Positions in metres with the default 2-unit cells: nearest() runs out
+    // of probes and DeliveryManager scans its free list instead
+    int small = count < 5000 ? count : 5000;
+    DeliveryManager metres;
+    vector<DeliveryAgent*> metreAgents = addAgents(metres, small, side * 1000, rng);
+    ok = check(compareNearest(metres, metreAgents, side * 1000, 2000, rng,
+                              to_string(small) + " free, metres, 2 m cells"),
+               "fallback scan matches with positions in metres") && ok;
+    return ok;
+}
+
+// ----------------------------------------------------------------------------
+// assign: Hungarian against auction
+// ----------------------------------------------------------------------------
+// Every row on its own column or none, never a FORBIDDEN cell, and the
+// reported total adds up
+static bool validMatching(const vector<int>& cost, int rows, int cols, const vector<int>& assignment,
+                          long long total) {
+    if ((int)assignment.size() != rows) return false;
+    vector<char> used(cols, 0);
+    long long sum = 0;
+    for (int i = 0; i < rows; i++) {
+        int j = assignment[i];
+        if (j == -1) continue;
+        if (j < 0 || j >= cols || used[j]) return false;
+        int c = cost[(size_t)i * cols + j];
+        if (c == AssignmentSolver::FORBIDDEN) return false;
+        used[j] = 1;
+        sum += c;
+    }
+    return sum == total;
+}
+
+// Tries every way to give rows row.. distinct columns (or none). Matching
+// as many rows as possible comes first, then avoiding FORBIDDEN cells,
+// then the total, as the solver's penalty does. best is (unmatched,
+// forbidden, total).
+static void tryAll(const vector<int>& cost, int rows, int cols, int row, vector<char>& used,
+                   int unmatched, int forbidden, long long total, long long best[3]) {
+    if (row == rows) {
+        long long key[3] = {unmatched, forbidden, total};
+        if (key[0] < best[0] || (key[0] == best[0] && (key[1] < best[1] || (key[1] == best[1] && key[2] < best[2])))) {
+            for (int k = 0; k < 3; k++) best[k] = key[k];
+        }
+        return;
+    }
+    tryAll(cost, rows, cols, row + 1, used, unmatched + 1, forbidden, total, best);
+    for (int j = 0; j < cols; j++) {
+        if (used[j]) continue;
+        used[j] = 1;
+        int c = cost[(size_t)row * cols + j];
+        if (c == AssignmentSolver::FORBIDDEN) {
+            tryAll(cost, rows, cols, row + 1, used, unmatched, forbidden + 1, total, best);
+        } else {
+            tryAll(cost, rows, cols, row + 1, used, unmatched, forbidden, total + c, best);
+        }
+        used[j] = 0;
+    }
+}
+
+static bool checkSolvers() {
+    mt19937 rng(37);
+    for (int round = 0; round < 500; round++) {
+        int rows = 1 + (int)(rng() % 6), cols = 1 + (int)(rng() % 6);
+        if (round % 5 == 0) cols = rows + 6; // Wide enough for the candidate column filter
+        vector<int> cost((size_t)rows * cols);
+        int maxCost = round % 2 == 0 ? 3 : 1000; // Few distinct costs means many ties
+        for (size_t k = 0; k < cost.size(); k++) {
+            cost[k] = rng() % 5 == 0 ? AssignmentSolver::FORBIDDEN : (int)(rng() % maxCost);
+        }
+        long long best[3] = {LLONG_MAX, LLONG_MAX, LLONG_MAX};
+        vector<char> used(cols, 0);
+        tryAll(cost, rows, cols, 0, used, 0, 0, 0, best);
+
+        vector<int> assignment;
+        long long total = AssignmentSolver::hungarian(cost, rows, cols, assignment);
+        if (total != best[2] || !validMatching(cost, rows, cols, assignment, total)) return false;
+        total = AssignmentSolver::auction(cost, rows, cols, assignment);
+        if (total != best[2] || !validMatching(cost, rows, cols, assignment, total)) return false;
+    }
+    return true;
+}
+
+// Metres from each of rows random pickups to each of cols random agents
+static vector<int> randomCosts(int rows, int cols, mt19937& rng) {
+    uniform_real_distribution<double> coord(0, 60000);
+    vector<double> px(rows), py(rows), ax(cols), ay(cols);
+    for (int i = 0; i < rows; i++) {
+        px[i] = coord(rng);
+        py[i] = coord(rng);
+    }
+    for (int j = 0; j < cols; j++) {
+        ax[j] = coord(rng);
+        ay[j] = coord(rng);
+    }
+    vector<int> cost((size_t)rows * cols);
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            cost[(size_t)i * cols + j] = (int)hypot(px[i] - ax[j], py[i] - ay[j]);
+        }
+    }
+    return cost;
+}
+
+static bool benchAssign(int maxBatch) {
+    bool ok = check(checkSolvers(), "both solvers match trying every matching on small tables");
+
+    cout << "Batch assignment, costs in metres over 60 x 60 km (solve() picks "
+         << "auction above " << AssignmentSolver::HUNGARIAN_LIMIT << " when nearly square)" << endl;
+    mt19937 rng(41);
+    const int batches[6] = {10, 50, 100, 200, 500, 1000};
+    for (int b = 0; b < 6 && batches[b] <= maxBatch; b++) {
+        int n = batches[b];
+        for (int spare = 1; spare <= 3; spare += 2) {
+            int cols = n * spare;
+            vector<int> cost = randomCosts(n, cols, rng);
+            vector<int> byHungarian, byAuction;
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            long long hungarianTotal = AssignmentSolver::hungarian(cost, n, cols, byHungarian);
+            double hungarianTime = secondsSince(start);
+            start = chrono::steady_clock::now();
+            long long auctionTotal = AssignmentSolver::auction(cost, n, cols, byAuction);
+            double auctionTime = secondsSince(start);
+            cout << "  " << n << " x " << cols << ": Hungarian " << hungarianTime * 1000 << " ms, auction "
+                 << auctionTime * 1000 << " ms" << endl;
+            ok = check(hungarianTotal == auctionTotal
+                       && validMatching(cost, n, cols, byHungarian, hungarianTotal)
+                       && validMatching(cost, n, cols, byAuction, auctionTotal),
+                       "Hungarian and auction agree on " + to_string(n) + " x " + to_string(cols)) && ok;
+        }
+    }
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    string section = argc > 1 ? argv[1] : "all";
+    int size = argc > 2 ? atoi(argv[2]) : 0;
+    if (section != "all" && section != "nearest" && section != "assign") {
+        cout << "Usage: " << argv[0] << " [nearest|assign] [size]" << endl;
+        return 1;
+    }
+    Display::useNullBackend();
+
+    bool ok = true;
+    if (section == "all" || section == "nearest") ok = benchNearest(size > 99 ? size : 50000) && ok;
+    if (section == "all" || section == "assign") ok = benchAssign(size > 0 ? size : 1000) && ok;
+    cout << (ok ? "All checks passed" : "Some checks FAILED") << endl;
+    return ok ? 0 : 1;
+}
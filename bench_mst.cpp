@@ -0,0 +1,349 @@
+// ============================================================================
+// BENCH MST - Timings and checks for the spanning tree builders
+// ============================================================================
+// Build:  g++ -O2 -std=c++17 -pthread -DDISPLAY_NO_DEMO bench_mst.cpp -o bench_mst
+// Usage:  bench_mst [section] [size]
+//
+// Sections (all of them when none is named):
+//   boruvka   MST::boruvka with 1, 2 and 4 threads against sorting the
+//             roads and running Kruskal over a DisjointSet, on a road grid
+//             of side x side sectors (default side 1000, 2M roads; 2236
+//             gives 10M roads and needs about 2 GB of memory). Totals must
+//             match, and random small and medium graphs (disconnected,
+//             directed, negative and tied weights) must give a valid
+//             spanning forest of the same weight as Kruskal.
+//   unionfind DisjointSet against ConcurrentDisjointSet on size elements
+//             (default 4M): size random unites, then 4 x size random
+//             connected() queries, with the concurrent set on 1 and 4
+//             threads. All three must end with the same groups and give
+//             the same answers.
+//   dynamic   DynamicMST following a side x side grid (default 500) through
+//             random weight changes and new diagonal roads, timed per update
+//             against one full MST::boruvka recompute. The tree weight must
+//             match a fresh Kruskal every 5000 updates, and after every
+//             single update on random small graphs.
+//
+// Every section checks its results and the program exits with 1 if one
+// is wrong, so the timings are never of a broken build.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "DisjointSet.h"
+#include "DynamicMST.h"
+#include "Graph.h"
+#include "MST.h"
+
+using namespace std;
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static bool check(bool ok, const string& what) {
+    if (!ok) cout << "  CHECK FAILED: " << what << endl;
+    return ok;
+}
+
+// side x side sectors, each joined to its right and lower neighbour by a
+// road of 1-maxWeight km
+static Graph* makeGrid(int side, unsigned seed, int maxWeight) {
+    Graph* g = new Graph(side * side);
+    mt19937 rng(seed);
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if (c + 1 < side) g->addEdge(u, u + 1, 1 + (int)(rng() % maxWeight));
+            if (r + 1 < side) g->addEdge(u, u + side, 1 + (int)(rng() % maxWeight));
+        }
+    }
+    return g;
+}
+
+// Reference: every road once, sorted by weight, joined through a
+// DisjointSet. Directed arcs count as undirected roads, as in boruvka.
+static MSTResult sortKruskal(const CSRGraph& g) {
+    int V = g.getNumVertices();
+    vector<EdgeTriple> edges;
+    edges.reserve(g.getNumArcs());
+    for (int u = 0; u < V; u++) {
+        for (int e = g.arcBegin(u); e < g.arcEnd(u); e++) {
+            int w = g.arcDest(e);
+            if (w != u && (g.isDirected() || u < w)) edges.push_back(EdgeTriple(u, w, g.arcWeight(e)));
+        }
+    }
+    sort(edges.begin(), edges.end());
+    DisjointSet sets(V);
+    MSTResult result;
+    for (size_t i = 0; i < edges.size(); i++) {
+        if (sets.unite(edges[i].src, edges[i].dest)) {
+            result.edges.push_back(edges[i]);
+            result.totalWeight += edges[i].weight;
+        }
+    }
+    return result;
+}
+
+// No cycles, one edge per joined component, edges are real roads and the
+// total adds up
+static bool validForest(const CSRGraph& g, const MSTResult& forest, int expectedEdges) {
+    int V = g.getNumVertices();
+    if ((int)forest.edges.size() != expectedEdges) return false;
+    DisjointSet sets(V);
+    long long total = 0;
+    for (size_t i = 0; i < forest.edges.size(); i++) {
+        const EdgeTriple& e = forest.edges[i];
+        if (e.src < 0 || e.src >= V || e.dest < 0 || e.dest >= V || !sets.unite(e.src, e.dest)) return false;
+        bool road = false;
+        for (int a = g.arcBegin(e.src); a < g.arcEnd(e.src) && !road; a++) {
+            road = g.arcDest(a) == e.dest && g.arcWeight(a) == e.weight;
+        }
+        for (int a = g.arcBegin(e.dest); a < g.arcEnd(e.dest) && !road; a++) {
+            road = g.arcDest(a) == e.src && g.arcWeight(a) == e.weight;
+        }
+        if (!road) return false;
+        total += e.weight;
+    }
+    return total == forest.totalWeight;
+}
+
+// ----------------------------------------------------------------------------
+// boruvka: parallel Boruvka against sort + Kruskal
+// ----------------------------------------------------------------------------
+static bool checkBoruvka() {
+    mt19937 rng(3);
+    for (int round = 0; round < 500; round++) {
+        int V = 1 + (int)(rng() % 60);
+        Graph g(V, round % 2 == 0);
+        int E = (int)(rng() % (3 * V));
+        for (int i = 0; i < E; i++) {
+            g.addEdge((int)(rng() % V), (int)(rng() % V), (int)(rng() % 21) - 10);
+        }
+        MSTResult expected = sortKruskal(g.csr());
+        MSTResult found = MST::boruvka(g);
+        if (found.totalWeight != expected.totalWeight) return false;
+        if (!validForest(g.csr(), found, (int)expected.edges.size())) return false;
+    }
+
+    // Large enough for boruvka to really use several threads; few distinct
+    // weights, so ties are everywhere
+    for (int round = 0; round < 3; round++) {
+        Graph* g = makeGrid(300, 20 + round, 3);
+        mt19937 extra(round);
+        int V = g->getNumVertices();
+        for (int i = 0; i < V / 2; i++) g->addEdge((int)(extra() % V), (int)(extra() % V), 1 + (int)(extra() % 3));
+        MSTResult expected = sortKruskal(g->csr());
+        MSTResult found = MST::boruvka(*g, 4);
+        bool same = found.totalWeight == expected.totalWeight
+                 && validForest(g->csr(), found, (int)expected.edges.size());
+        delete g;
+        if (!same) return false;
+    }
+    return true;
+}
+
+static bool benchBoruvka(int side) {
+    bool ok = check(checkBoruvka(), "boruvka matches Kruskal on random graphs");
+
+    Graph* g = makeGrid(side, 1, 1000);
+    const CSRGraph& csr = g->csr();
+    cout << "MST of a " << side << " x " << side << " grid, " << csr.getNumArcs() / 2 << " roads" << endl;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    MSTResult expected = sortKruskal(csr);
+    cout << "  sort + Kruskal:       " << secondsSince(start) * 1000 << " ms" << endl;
+    ok = check((int)expected.edges.size() == csr.getNumVertices() - 1, "Kruskal spans the grid") && ok;
+
+    const int threadCounts[3] = {1, 2, 4};
+    for (int i = 0; i < 3; i++) {
+        start = chrono::steady_clock::now();
+        MSTResult found = MST::boruvka(csr, threadCounts[i]);
+        cout << "  Boruvka, " << threadCounts[i] << " thread(s):  " << secondsSince(start) * 1000 << " ms" << endl;
+        ok = check(found.totalWeight == expected.totalWeight && found.edges.size() == expected.edges.size(),
+                   "boruvka total matches Kruskal") && ok;
+    }
+    cout << "  Total weight:         " << expected.totalWeight << " km" << endl;
+    delete g;
+    return ok;
+}
+
+// ----------------------------------------------------------------------------
+// unionfind: sequential against concurrent disjoint sets
+// ----------------------------------------------------------------------------
+// Same groups: x and y share a root in a exactly when they do in b
+template <class A, class B>
+static bool sameGroups(A& a, B& b, int n) {
+    vector<int> aToB(n, -1), bToA(n, -1);
+    for (int x = 0; x < n; x++) {
+        int ra = a.find(x), rb = b.find(x);
+        if (aToB[ra] == -1 && bToA[rb] == -1) {
+            aToB[ra] = rb;
+            bToA[rb] = ra;
+        } else if (aToB[ra] != rb || bToA[rb] != ra) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Runs body(first, last, t) on threads contiguous blocks of [0, n)
+template <class Body>
+static void onThreads(int n, int threads, Body body) {
+    vector<thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back(body, (int)((long long)n * t / threads), (int)((long long)n * (t + 1) / threads), t);
+    }
+    for (size_t t = 0; t < pool.size(); t++) pool[t].join();
+}
+
+static bool benchUnionFind(int n) {
+    const int unites = n;
+    const int finds = 4 * n;
+    cout << "Disjoint sets of " << n << " elements, " << unites << " unites, " << finds << " finds" << endl;
+    mt19937 rng(17);
+    vector<int> pairs(2 * (size_t)(unites + finds));
+    for (size_t i = 0; i < pairs.size(); i++) pairs[i] = (int)(rng() % n);
+    const int* query = &pairs[2 * (size_t)unites];
+
+    DisjointSet plain(n);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int i = 0; i < unites; i++) plain.unite(pairs[2 * i], pairs[2 * i + 1]);
+    double uniteTime = secondsSince(start);
+    start = chrono::steady_clock::now();
+    long long expected = 0;
+    for (int i = 0; i < finds; i++) expected += plain.connected(query[2 * i], query[2 * i + 1]);
+    cout << "  DisjointSet:              " << uniteTime * 1000 << " ms unite, "
+         << secondsSince(start) * 1000 << " ms find" << endl;
+
+    bool ok = true;
+    const int threadCounts[2] = {1, 4};
+    for (int c = 0; c < 2; c++) {
+        int threads = threadCounts[c];
+        ConcurrentDisjointSet shared(n);
+        start = chrono::steady_clock::now();
+        onThreads(unites, threads, [&](int first, int last, int) {
+            for (int i = first; i < last; i++) shared.unite(pairs[2 * i], pairs[2 * i + 1]);
+        });
+        uniteTime = secondsSince(start);
+        vector<long long> counts(threads, 0);
+        start = chrono::steady_clock::now();
+        onThreads(finds, threads, [&](int first, int last, int t) {
+            long long count = 0;
+            for (int i = first; i < last; i++) count += shared.connected(query[2 * i], query[2 * i + 1]);
+            counts[t] = count;
+        });
+        double findTime = secondsSince(start);
+        cout << "  ConcurrentDisjointSet, " << threads << ": " << uniteTime * 1000 << " ms unite, "
+             << findTime * 1000 << " ms find" << endl;
+        long long total = 0;
+        for (int t = 0; t < threads; t++) total += counts[t];
+        ok = check(total == expected && sameGroups(plain, shared, n),
+                   "concurrent set matches DisjointSet on " + to_string(threads) + " thread(s)") && ok;
+    }
+
+    // Interleaved unites and queries on small sets, answer by answer
+    bool same = true;
+    for (int round = 0; round < 200 && same; round++) {
+        int m = 1 + (int)(rng() % 50);
+        DisjointSet a(m);
+        ConcurrentDisjointSet b(m);
+        for (int i = 0; i < 200 && same; i++) {
+            int x = (int)(rng() % m), y = (int)(rng() % m);
+            if (rng() % 2) same = a.unite(x, y) == b.unite(x, y);
+            else same = a.connected(x, y) == b.connected(x, y);
+        }
+    }
+    ok = check(same, "both sets give the same answers step by step") && ok;
+    return ok;
+}
+
+// ----------------------------------------------------------------------------
+// dynamic: DynamicMST updates against recomputing
+// ----------------------------------------------------------------------------
+static bool sameAsKruskal(Graph& g, DynamicMST& dynamic) {
+    MSTResult expected = sortKruskal(g.csr());
+    return dynamic.getTotalWeight() == expected.totalWeight
+        && validForest(g.csr(), dynamic.current(), (int)expected.edges.size());
+}
+
+static bool checkDynamic() {
+    mt19937 rng(23);
+    for (int round = 0; round < 300; round++) {
+        int V = 1 + (int)(rng() % 30);
+        Graph g(V, round % 2 == 0);
+        int E = (int)(rng() % (2 * V));
+        for (int i = 0; i < E; i++) g.addEdge((int)(rng() % V), (int)(rng() % V), (int)(rng() % 50));
+        DynamicMST dynamic(g);
+        if (!sameAsKruskal(g, dynamic)) return false;
+        for (int step = 0; step < 40; step++) {
+            int u = (int)(rng() % V), v = (int)(rng() % V), w = (int)(rng() % 50);
+            if (rng() % 3 == 0) g.addEdge(u, v, w);
+            else g.updateEdge(u, v, w); // Often no such road, which must change nothing
+            if (!sameAsKruskal(g, dynamic)) return false;
+        }
+    }
+    return true;
+}
+
+static bool benchDynamic(int side) {
+    bool ok = check(checkDynamic(), "DynamicMST matches Kruskal after every update on random graphs");
+
+    const int updates = 20000;
+    Graph* g = makeGrid(side, 5, 1000);
+    int V = g->getNumVertices();
+    cout << "Dynamic MST on a " << side << " x " << side << " grid, " << updates << " updates" << endl;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    DynamicMST* dynamic = new DynamicMST(*g);
+    cout << "  Initial build:        " << secondsSince(start) * 1000 << " ms" << endl;
+
+    mt19937 rng(29);
+    double updateTime = 0;
+    bool same = true;
+    for (int i = 1; i <= updates; i++) {
+        int r = (int)(rng() % (side - 1)), c = (int)(rng() % (side - 1));
+        int u = r * side + c;
+        int w = 1 + (int)(rng() % 1000);
+        start = chrono::steady_clock::now();
+        switch (rng() % 4) {
+            case 0: g->addEdge(u, u + side + 1, w); break;      // New diagonal link
+            case 1: g->updateEdge(u, u + 1, w); break;
+            case 2: g->updateEdge(u, u + side, w); break;
+            default: g->updateEdge(u, u + 1, 1000 + w); break; // Road made much slower
+        }
+        updateTime += secondsSince(start);
+        if (i % 5000 == 0 && dynamic->getTotalWeight() != sortKruskal(g->csr()).totalWeight) same = false;
+    }
+    cout << "  Per update:           " << updateTime * 1e6 / updates << " us" << endl;
+    ok = check(same, "DynamicMST total matches Kruskal after updates") && ok;
+
+    start = chrono::steady_clock::now();
+    MSTResult full = MST::boruvka(*g);
+    cout << "  Boruvka recompute:    " << secondsSince(start) * 1000 << " ms" << endl;
+    ok = check(full.totalWeight == dynamic->getTotalWeight() && (int)full.edges.size() == V - 1,
+               "DynamicMST total matches a full recompute") && ok;
+    delete dynamic;
+    delete g;
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    string section = argc > 1 ? argv[1] : "all";
+    int size = argc > 2 ? atoi(argv[2]) : 0;
+    if (section != "all" && section != "boruvka" && section != "unionfind" && section != "dynamic") {
+        cout << "Usage: " << argv[0] << " [boruvka|unionfind|dynamic] [size]" << endl;
+        return 1;
+    }
+    Display::useNullBackend();
+
+    bool ok = true;
+    if (section == "all" || section == "boruvka") ok = benchBoruvka(size > 1 ? size : 1000) && ok;
+    if (section == "all" || section == "unionfind") ok = benchUnionFind(size > 0 ? size : 4000000) && ok;
+    if (section == "all" || section == "dynamic") ok = benchDynamic(size > 1 ? size : 500) && ok;
+    cout << (ok ? "All checks passed" : "Some checks FAILED") << endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,441 @@
+// ============================================================================
+// BENCH ROUTING - Timings and checks for the road graph and its searches
+// ============================================================================
+// Build:  g++ -O2 -std=c++17 -pthread -DDISPLAY_NO_DEMO bench_routing.cpp -o bench_routing
+// Usage:  bench_routing [section] [grid side]
+//
+// Every section runs on a synthetic road grid: side x side sectors, each
+// joined to its right and lower neighbour by a road of 10-19 km.
+//
+// Sections (all of them when none is named):
+//   csr       build the grid with addEdge, freeze it to CSR, and time one
+//             full Dijkstra walking the adjacency lists against the same
+//             search over the CSR arrays (default side 1000, 1M sectors).
+//             The printing Dijkstra, Prim and Kruskal run on a small grid
+//             and must agree with it.
+//   point     random point-to-point queries with ShortestPathEngine, plain
+//             Dijkstra, A* over sector coordinates and bidirectional
+//             Dijkstra: settled sectors and time per query (default side
+//             700, 200 queries). Random small graphs, directed and
+//             undirected, with and without coordinates and with roads added
+//             between queries, check every mode against Dijkstra.
+//   ch        contraction hierarchy: preprocessing time, shortcuts and
+//             memory, save and load time, and query time (median and 99th
+//             percentile) and settled sectors against plain Dijkstra
+//             (default side 200, 1000 queries; build time grows quickly,
+//             400 takes about two minutes). Every query must agree with
+//             Dijkstra, as must all pairs on random small graphs, and a
+//             saved hierarchy must load back and answer the same.
+//   table     DistanceTable: 100 x 100 and 1000 x 1000 tables of random
+//             sectors from one-to-many searches and from a contraction
+//             hierarchy (default side 200). Both tables must be equal and
+//             agree with point-to-point queries on a sample of cells.
+//
+// Every section checks its results and the program exits with 1 if one
+// is wrong, so the timings are never of a broken build.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "ContractionHierarchy.h"
+#include "Dijkstra.h"
+#include "DistanceTable.h"
+#include "Graph.h"
+#include "IndexedHeap.h"
+#include "MST.h"
+#include "ShortestPathEngine.h"
+
+using namespace std;
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static bool check(bool ok, const string& what) {
+    if (!ok) cout << "  CHECK FAILED: " << what << endl;
+    return ok;
+}
+
+// With positions, sectors sit one unit apart, so every road is at least
+// 10 times its straight-line length
+static Graph* makeGrid(int side, unsigned seed, bool positions = false) {
+    Graph* g = new Graph(side * side);
+    mt19937 rng(seed);
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if (positions) g->setPosition(u, c, r);
+            if (c + 1 < side) g->addEdge(u, u + 1, 10 + (int)(rng() % 10));
+            if (r + 1 < side) g->addEdge(u, u + side, 10 + (int)(rng() % 10));
+        }
+    }
+    return g;
+}
+
+// Runs body with cout going into a string, for the printing algorithms
+template <typename Body>
+static string captureOutput(Body body) {
+    ostringstream out;
+    streambuf* previous = cout.rdbuf(out.rdbuf());
+    body();
+    cout.rdbuf(previous);
+    return out.str();
+}
+
+// The number printed after label, or -1 if label is not in text
+static long long numberAfter(const string& text, const string& label) {
+    size_t at = text.rfind(label);
+    if (at == string::npos) return -1;
+    return atoll(text.c_str() + at + label.size());
+}
+
+// ----------------------------------------------------------------------------
+// csr: adjacency lists against CSR arrays
+// ----------------------------------------------------------------------------
+// Both searches are the same code apart from how they walk a vertex's
+// roads, and return all distances from src
+static vector<int> listDijkstra(Graph& g, int src) {
+    int V = g.getNumVertices();
+    vector<int> dist(V, INT_MAX);
+    IndexedHeap<int> heap(V);
+    dist[src] = 0;
+    heap.insert(src, 0);
+    while (!heap.isEmpty()) {
+        int u = heap.extractMin();
+        for (Node<Edge>* temp = g.getAdjList(u).getHead(); temp; temp = temp->next) {
+            int v = temp->data.dest;
+            if (dist[u] + temp->data.weight < dist[v]) {
+                dist[v] = dist[u] + temp->data.weight;
+                heap.push(v, dist[v]);
+            }
+        }
+    }
+    return dist;
+}
+
+static vector<int> csrDijkstra(const CSRGraph& g, int src) {
+    int V = g.getNumVertices();
+    vector<int> dist(V, INT_MAX);
+    IndexedHeap<int> heap(V);
+    dist[src] = 0;
+    heap.insert(src, 0);
+    while (!heap.isEmpty()) {
+        int u = heap.extractMin();
+        for (int e = g.arcBegin(u); e < g.arcEnd(u); e++) {
+            int v = g.arcDest(e);
+            if (dist[u] + g.arcWeight(e) < dist[v]) {
+                dist[v] = dist[u] + g.arcWeight(e);
+                heap.push(v, dist[v]);
+            }
+        }
+    }
+    return dist;
+}
+
+static bool benchCsr(int side) {
+    cout << "CSR on a " << side << " x " << side << " grid" << endl;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    Graph* g = makeGrid(side, 1);
+    cout << "  addEdge build:        " << secondsSince(start) * 1000 << " ms" << endl;
+    start = chrono::steady_clock::now();
+    const CSRGraph& csr = g->csr();
+    cout << "  CSR freeze:           " << secondsSince(start) * 1000 << " ms" << endl;
+
+    start = chrono::steady_clock::now();
+    vector<int> fromLists = listDijkstra(*g, 0);
+    cout << "  Dijkstra, lists:      " << secondsSince(start) * 1000 << " ms" << endl;
+    start = chrono::steady_clock::now();
+    vector<int> fromCsr = csrDijkstra(csr, 0);
+    cout << "  Dijkstra, CSR:        " << secondsSince(start) * 1000 << " ms" << endl;
+    bool ok = check(fromLists == fromCsr, "both Dijkstras give the same distances");
+    delete g;
+
+    // The teaching versions print every step, so they run on a small grid
+    Graph* small = makeGrid(12, 2);
+    int last = small->getNumVertices() - 1;
+    vector<int> expected = csrDijkstra(small->csr(), 0);
+    string path = captureOutput([&]() { Dijkstra::findShortestPath(*small, 0, last); });
+    string prim = captureOutput([&]() { MST::prims(*small); });
+    string kruskal = captureOutput([&]() { MST::kruskals(*small); });
+    ok = check(numberAfter(path, "Shortest Distance: ") == expected[last],
+               "Dijkstra::findShortestPath agrees with the quiet search") && ok;
+    long long primTotal = numberAfter(prim, "Total Network Distance: ");
+    ok = check(primTotal > 0 && primTotal == numberAfter(kruskal, "Total Network Distance: "),
+               "Prim and Kruskal find the same MST weight") && ok;
+    delete small;
+    return ok;
+}
+
+// ----------------------------------------------------------------------------
+// point: point-to-point search modes
+// ----------------------------------------------------------------------------
+static const int NUM_MODES = 3;
+static const ShortestPathEngine::Mode MODES[NUM_MODES] = {
+    ShortestPathEngine::DIJKSTRA, ShortestPathEngine::ASTAR, ShortestPathEngine::BIDIRECTIONAL
+};
+static const char* MODE_NAMES[NUM_MODES] = {"Dijkstra", "A*", "Bidirectional"};
+
+// The path runs from src to dest over real roads and adds up to distance
+static bool validRoute(const CSRGraph& g, int src, int dest, const RouteResult& route) {
+    if (route.path.empty() || route.path.front() != src || route.path.back() != dest) return false;
+    long long total = 0;
+    for (size_t i = 0; i + 1 < route.path.size(); i++) {
+        int best = -1;
+        for (int e = g.arcBegin(route.path[i]); e < g.arcEnd(route.path[i]); e++) {
+            if (g.arcDest(e) == route.path[i + 1] && (best < 0 || g.arcWeight(e) < best)) best = g.arcWeight(e);
+        }
+        if (best < 0) return false;
+        total += best;
+    }
+    return total == route.distance;
+}
+
+// Every mode on every pair of a few hundred small random graphs
+static bool checkModes() {
+    mt19937 rng(5);
+    for (int round = 0; round < 300; round++) {
+        int V = 2 + (int)(rng() % 40);
+        bool directed = round % 2 == 0;
+        Graph g(V, directed);
+        if (round % 3 != 0) {
+            for (int v = 0; v < V; v++) g.setPosition(v, rng() % 100, rng() % 100);
+        }
+        int E = (int)(rng() % (3 * V));
+        for (int i = 0; i < E; i++) g.addEdge((int)(rng() % V), (int)(rng() % V), (int)(rng() % 50));
+
+        // The engines must pick up roads added after their first queries
+        ShortestPathEngine reference(g);
+        ShortestPathEngine engine(g);
+        RouteResult route;
+        for (int pass = 0; pass < 2; pass++) {
+            for (int m = 1; m < NUM_MODES; m++) {
+                engine.setMode(MODES[m]);
+                for (int src = 0; src < V; src++) {
+                    for (int dest = 0; dest < V; dest++) {
+                        int expected = reference.distance(src, dest);
+                        engine.findRoute(src, dest, route);
+                        if (route.distance != expected) return false;
+                        if (expected != ShortestPathEngine::UNREACHABLE && !validRoute(g.csr(), src, dest, route)) {
+                            return false;
+                        }
+                    }
+                }
+            }
+            for (int i = 0; i < 3; i++) g.addEdge((int)(rng() % V), (int)(rng() % V), (int)(rng() % 50));
+        }
+    }
+    return true;
+}
+
+static bool benchPoint(int side) {
+    bool ok = check(checkModes(), "every search mode matches Dijkstra on random graphs");
+
+    const int queries = 200;
+    Graph* g = makeGrid(side, 3, true);
+    int V = g->getNumVertices();
+    cout << "Point-to-point on a " << side << " x " << side << " grid, " << queries << " queries" << endl;
+    vector<int> srcs(queries), dests(queries), expected(queries);
+    mt19937 rng(9);
+    for (int q = 0; q < queries; q++) {
+        srcs[q] = (int)(rng() % V);
+        dests[q] = (int)(rng() % V);
+    }
+
+    ShortestPathEngine engine(*g);
+    for (int m = 0; m < NUM_MODES; m++) {
+        engine.setMode(MODES[m]);
+        engine.distance(0, 0); // Allocate any per-mode state outside the timing
+        long long settled = 0;
+        bool same = true;
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        for (int q = 0; q < queries; q++) {
+            int d = engine.distance(srcs[q], dests[q]);
+            settled += engine.lastSettledCount();
+            if (m == 0) expected[q] = d;
+            else if (d != expected[q]) same = false;
+        }
+        double elapsed = secondsSince(start);
+        cout << "  " << MODE_NAMES[m] << ": " << settled / queries << " settled, "
+             << elapsed * 1000 / queries << " ms per query" << endl;
+        ok = check(same, string(MODE_NAMES[m]) + " distances match Dijkstra") && ok;
+    }
+    delete g;
+    return ok;
+}
+
+// ----------------------------------------------------------------------------
+// ch: contraction hierarchy against Dijkstra
+// ----------------------------------------------------------------------------
+// All pairs of a few hundred small random graphs, directed and undirected
+static bool checkHierarchy() {
+    mt19937 rng(7);
+    for (int round = 0; round < 300; round++) {
+        int V = 2 + (int)(rng() % 40);
+        Graph g(V, round % 2 == 0);
+        int E = (int)(rng() % (3 * V));
+        for (int i = 0; i < E; i++) g.addEdge((int)(rng() % V), (int)(rng() % V), (int)(rng() % 50));
+
+        ShortestPathEngine reference(g);
+        ContractionHierarchy ch;
+        ch.build(g);
+        RouteResult route;
+        for (int src = 0; src < V; src++) {
+            for (int dest = 0; dest < V; dest++) {
+                int expected = reference.distance(src, dest);
+                bool found = ch.findRoute(src, dest, route);
+                if (found != (expected != ContractionHierarchy::UNREACHABLE)) return false;
+                if (found && (route.distance != expected || !validRoute(g.csr(), src, dest, route))) return false;
+            }
+        }
+    }
+    return true;
+}
+
+static double percentile(vector<double> times, double p) {
+    sort(times.begin(), times.end());
+    return times[(size_t)(p * (times.size() - 1))];
+}
+
+static bool benchCh(int side) {
+    bool ok = check(checkHierarchy(), "hierarchy matches Dijkstra on random graphs");
+
+    const int queries = 1000;
+    Graph* g = makeGrid(side, 4);
+    int V = g->getNumVertices();
+    cout << "Contraction hierarchy on a " << side << " x " << side << " grid, " << queries << " queries" << endl;
+
+    ContractionHierarchy ch;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    ch.build(*g);
+    cout << "  Preprocessing:        " << secondsSince(start) << " s, " << ch.getNumShortcuts()
+         << " shortcuts, " << ch.memoryBytes() / (1024 * 1024.0) << " MB" << endl;
+
+    const string file = "bench_routing.ch";
+    start = chrono::steady_clock::now();
+    bool saved = ch.save(file);
+    cout << "  Save:                 " << secondsSince(start) * 1000 << " ms" << endl;
+    ContractionHierarchy loaded;
+    start = chrono::steady_clock::now();
+    bool read = saved && loaded.load(file);
+    cout << "  Load:                 " << secondsSince(start) * 1000 << " ms" << endl;
+    remove(file.c_str());
+    ok = check(read && loaded.matches(*g), "saved hierarchy loads back for the same map") && ok;
+
+    vector<int> srcs(queries), dests(queries);
+    mt19937 rng(11);
+    for (int q = 0; q < queries; q++) {
+        srcs[q] = (int)(rng() % V);
+        dests[q] = (int)(rng() % V);
+    }
+
+    ShortestPathEngine engine(*g);
+    engine.distance(0, 0);
+    ch.distance(0, 0);
+    vector<double> dijkstraTimes(queries), chTimes(queries);
+    long long dijkstraSettled = 0, chSettled = 0;
+    bool same = true;
+    bool sameLoaded = true;
+    for (int q = 0; q < queries; q++) {
+        start = chrono::steady_clock::now();
+        int expected = engine.distance(srcs[q], dests[q]);
+        dijkstraTimes[q] = secondsSince(start);
+        dijkstraSettled += engine.lastSettledCount();
+
+        start = chrono::steady_clock::now();
+        int d = ch.distance(srcs[q], dests[q]);
+        chTimes[q] = secondsSince(start);
+        chSettled += ch.lastSettledCount();
+        if (d != expected) same = false;
+        if (read && loaded.distance(srcs[q], dests[q]) != expected) sameLoaded = false;
+    }
+    cout << "  Dijkstra: " << dijkstraSettled / queries << " settled, median "
+         << percentile(dijkstraTimes, 0.5) * 1000 << " ms, p99 " << percentile(dijkstraTimes, 0.99) * 1000 << " ms" << endl;
+    cout << "  CH:       " << chSettled / queries << " settled, median "
+         << percentile(chTimes, 0.5) * 1e6 << " us, p99 " << percentile(chTimes, 0.99) * 1e6 << " us" << endl;
+    ok = check(same, "hierarchy distances match Dijkstra") && ok;
+    ok = check(sameLoaded, "loaded hierarchy distances match Dijkstra") && ok;
+
+    // A road added after build() makes the hierarchy stale
+    g->addEdge(0, V - 1, 1);
+    ok = check(!ch.matches(*g), "hierarchy no longer matches a changed map") && ok;
+    delete g;
+    return ok;
+}
+
+// ----------------------------------------------------------------------------
+// table: many-to-many distance tables
+// ----------------------------------------------------------------------------
+static bool sameTable(const DistanceTable& a, const DistanceTable& b) {
+    if (a.rows() != b.rows() || a.cols() != b.cols()) return false;
+    for (int i = 0; i < a.rows(); i++) {
+        for (int j = 0; j < a.cols(); j++) {
+            if (a.at(i, j) != b.at(i, j)) return false;
+        }
+    }
+    return true;
+}
+
+static bool benchTable(int side) {
+    Graph* g = makeGrid(side, 5);
+    int V = g->getNumVertices();
+    cout << "Distance tables on a " << side << " x " << side << " grid" << endl;
+    ContractionHierarchy ch;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    ch.build(*g);
+    cout << "  Hierarchy build:      " << secondsSince(start) << " s" << endl;
+
+    ShortestPathEngine engine(*g);
+    mt19937 rng(13);
+    bool ok = true;
+    const int sizes[2] = {100, 1000};
+    for (int s = 0; s < 2; s++) {
+        int n = sizes[s];
+        vector<int> sources(n), targets(n);
+        for (int i = 0; i < n; i++) {
+            sources[i] = (int)(rng() % V);
+            targets[i] = (int)(rng() % V);
+        }
+        DistanceTable fromSearches, fromHierarchy;
+        start = chrono::steady_clock::now();
+        bool built = fromSearches.compute(*g, sources, targets);
+        cout << "  " << n << " x " << n << " by searches:  " << secondsSince(start) * 1000 << " ms" << endl;
+        start = chrono::steady_clock::now();
+        built = fromHierarchy.compute(ch, sources, targets) && built;
+        cout << "  " << n << " x " << n << " by hierarchy: " << secondsSince(start) * 1000 << " ms" << endl;
+        ok = check(built && sameTable(fromSearches, fromHierarchy), "both tables are equal") && ok;
+
+        bool same = true;
+        for (int k = 0; k < 2000; k++) {
+            int i = (int)(rng() % n), j = (int)(rng() % n);
+            if (fromSearches.at(i, j) != engine.distance(sources[i], targets[j])) same = false;
+        }
+        ok = check(same, "table cells match point-to-point queries") && ok;
+    }
+    delete g;
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    string section = argc > 1 ? argv[1] : "all";
+    int side = argc > 2 ? atoi(argv[2]) : 0;
+    if (section != "all" && section != "csr" && section != "point" && section != "ch" && section != "table") {
+        cout << "Usage: " << argv[0] << " [csr|point|ch|table] [grid side]" << endl;
+        return 1;
+    }
+    Display::useNullBackend();
+
+    bool ok = true;
+    if (section == "all" || section == "csr") ok = benchCsr(side > 1 ? side : 1000) && ok;
+    if (section == "all" || section == "point") ok = benchPoint(side > 1 ? side : 700) && ok;
+    if (section == "all" || section == "ch") ok = benchCh(side > 1 ? side : 200) && ok;
+    if (section == "all" || section == "table") ok = benchTable(side > 1 ? side : 200) && ok;
+    cout << (ok ? "All checks passed" : "Some checks FAILED") << endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+// ============================================================================
+// MAP CONVERTER - Text road map (edge list or DIMACS) to binary CSR
+// ============================================================================
+// Build:  g++ -O2 -std=c++17 -DDISPLAY_NO_DEMO map_convert.cpp -o map_convert
+// Usage:  map_convert <input.txt|input.gr> <output.csr> [--directed]
+//
+// Parses the text map once, writes the binary file, then opens the result
+// again to check it and to show how long each kind of startup takes.
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include "RoadMapIO.h"
+
+using namespace std;
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3 || argc > 4 || (argc == 4 && string(argv[3]) != "--directed")) {
+        cout << "Usage: " << argv[0] << " <input.txt|input.gr> <output.csr> [--directed]" << endl;
+        return 1;
+    }
+    string input = argv[1];
+    string output = argv[2];
+    bool directed = argc == 4;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    CSRGraph* g = RoadMapIO::loadText(input, directed);
+    if (!g) return 1;
+    double parseTime = secondsSince(start);
+
+    cout << input << ": " << g->getNumVertices() << " vertices, " << g->getNumArcs() << " arcs"
+         << (g->isDirected() ? " (directed)" : " (undirected)")
+         << (g->hasPositions() ? ", with coordinates" : "") << endl;
+    cout << "Text load:   " << parseTime * 1000 << " ms" << endl;
+
+    start = chrono::steady_clock::now();
+    bool saved = RoadMapIO::saveBinary(*g, output);
+    double saveTime = secondsSince(start);
+    if (!saved) {
+        delete g;
+        return 1;
+    }
+    cout << "Binary save: " << saveTime * 1000 << " ms" << endl;
+
+    start = chrono::steady_clock::now();
+    CSRGraph* mapped = RoadMapIO::openBinary(output);
+    double openTime = secondsSince(start);
+    if (!mapped) {
+        delete g;
+        return 1;
+    }
+    cout << "Binary open: " << openTime * 1000 << " ms" << endl;
+
+    bool same = mapped->getNumVertices() == g->getNumVertices()
+             && mapped->getNumArcs() == g->getNumArcs();
+    for (int u = 0; same && u < g->getNumVertices(); u++) {
+        same = mapped->arcBegin(u) == g->arcBegin(u);
+    }
+    for (int e = 0; same && e < g->getNumArcs(); e++) {
+        same = mapped->arcDest(e) == g->arcDest(e) && mapped->arcWeight(e) == g->arcWeight(e);
+    }
+    delete mapped;
+    delete g;
+
+    if (!same) {
+        Display::printError("Binary file does not match the text map");
+        return 1;
+    }
+    cout << "Wrote " << output << endl;
+    return 0;
+}
@@ -0,0 +1,107 @@
+// ============================================================================
+// SIMULATE - Headless full-day run of the delivery system
+// ============================================================================
+// Build:  g++ -O2 -std=c++17 -DDISPLAY_NO_DEMO simulate.cpp -o simulate
+// Usage:  simulate [--map city.csr] [--ch city.ch] [--grid N] [--orders N]
+//                  [--agents N] [--restaurants N] [--speed D] [--seed N]
+//
+// Without --map an N x N grid city is generated (blocks of 100-300 m, so
+// road weights are metres and --speed is metres per minute). --ch loads the
+// contraction hierarchy from that file, or builds it and saves it there if
+// the file is missing or was built for a different map.
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "RoadMapIO.h"
+#include "Simulator.h"
+
+using namespace std;
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Grid streets 200 m apart on average; positions in km
+static Graph* makeGridCity(int side, unsigned seed) {
+    Graph* g = new Graph(side * side);
+    srand(seed);
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int u = r * side + c;
+            g->setPosition(u, 0.2 * c, 0.2 * r);
+            if (c + 1 < side) g->addEdge(u, u + 1, 100 + rand() % 201);
+            if (r + 1 < side) g->addEdge(u, u + side, 100 + rand() % 201);
+        }
+    }
+    return g;
+}
+
+int main(int argc, char* argv[]) {
+    string mapPath, chPath;
+    int side = 150;
+    SimulationConfig config;
+    config.ordersPerDay = 100000;
+    config.agents = 4000;
+    config.restaurants = 2000;
+    config.distancePerMinute = 400;   // 24 km/h on metre weights
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (i + 1 >= argc) {
+            cout << "Missing value for " << arg << endl;
+            return 1;
+        }
+        string value = argv[++i];
+        if (arg == "--map") mapPath = value;
+        else if (arg == "--ch") chPath = value;
+        else if (arg == "--grid") side = atoi(value.c_str());
+        else if (arg == "--orders") config.ordersPerDay = atof(value.c_str());
+        else if (arg == "--agents") config.agents = atoi(value.c_str());
+        else if (arg == "--restaurants") config.restaurants = atoi(value.c_str());
+        else if (arg == "--speed") config.distancePerMinute = atof(value.c_str());
+        else if (arg == "--seed") config.seed = (unsigned)atoi(value.c_str());
+        else {
+            cout << "Usage: " << argv[0] << " [--map city.csr] [--ch city.ch] [--grid N] [--orders N]"
+                 << " [--agents N] [--restaurants N] [--speed D] [--seed N]" << endl;
+            return 1;
+        }
+    }
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    Graph* grid = nullptr;
+    CSRGraph* mapped = nullptr;
+    if (!mapPath.empty()) {
+        mapped = RoadMapIO::openBinary(mapPath);
+        if (!mapped) return 1;
+    } else if (side > 1) {
+        grid = makeGridCity(side, config.seed);
+    } else {
+        Display::printError("Grid side must be at least 2");
+        return 1;
+    }
+    const CSRGraph& map = mapped ? *mapped : grid->csr();
+    cout << "Map: " << map.getNumVertices() << " vertices, " << map.getNumArcs() << " arcs ("
+         << secondsSince(start) << " s)" << endl;
+
+    ContractionHierarchy ch;
+    start = chrono::steady_clock::now();
+    if (!chPath.empty() && ifstream(chPath.c_str()).good() && ch.load(chPath) && ch.matches(map)) {
+        cout << "Hierarchy loaded from " << chPath;
+    } else {
+        ch.build(map);
+        cout << "Hierarchy built";
+        if (!chPath.empty() && ch.save(chPath)) cout << ", saved to " << chPath;
+    }
+    cout << " (" << secondsSince(start) << " s)" << endl;
+
+    DeliverySimulator sim(map, ch, config);
+    SimulationReport report = sim.run();
+    report.print();
+
+    delete mapped;
+    delete grid;
+    return report.ordersDelivered > 0 ? 0 : 1;
+}
@@ -0,0 +1,103 @@
+// ============================================================================
+// STRESS ORDERS - Many threads through the concurrent OrderManager
+// ============================================================================
+// Build:  g++ -O2 -std=c++17 -pthread -DDISPLAY_NO_DEMO stress_orders.cpp -o stress_orders
+// Usage:  stress_orders [max threads] [orders per producer]
+//
+// For 1, 2, 4, ... max threads on each side, producers place orders (each
+// with a menu item, so list nodes come from the NodePool) while consumers
+// take them. Every order must come out exactly once, and one producer's
+// orders must reach any one consumer in the order they were placed.
+//
+// Threads are started and joined every round, so nodes made on one thread
+// are freed on another after their owner has exited. A global list built on
+// the main thread is destroyed after the main thread's pool state, which is
+// the path NodePool::stateDead() covers. Run under -fsanitize=address or
+// -fsanitize=thread to check both.
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "OrderManager.h"
+
+using namespace std;
+
+// Destroyed after main() returns, once the main thread's NodePool state is gone
+static LinkedList<MenuItem> leftovers;
+
+static double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Returns false if an order was lost, duplicated or reordered
+static bool runRound(int threads, int perProducer) {
+    OrderManager om(4096);
+    long long total = (long long)threads * perProducer;
+    vector<atomic<char>> seen(total);
+    for (long long i = 0; i < total; i++) seen[i].store(0);
+    atomic<long long> consumed(0);
+    atomic<bool> failed(false);
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (int p = 0; p < threads; p++) {
+        workers.push_back(thread([&om, p, perProducer]() {
+            for (int i = 0; i < perProducer; i++) {
+                Order o(to_string(p) + ":" + to_string(i), "C" + to_string(p), "R001");
+                o.addItem(MenuItem("M001", "Biryani", 450.0, "Desi"));
+                while (!om.placeOrder(o)) this_thread::yield();
+            }
+        }));
+    }
+    for (int c = 0; c < threads; c++) {
+        workers.push_back(thread([&, threads]() {
+            vector<int> lastFrom(threads, -1);
+            Order o;
+            while (consumed.load(memory_order_relaxed) < total) {
+                if (!om.tryGetNextOrder(o)) {
+                    this_thread::yield();
+                    continue;
+                }
+                size_t colon = o.orderID.find(':');
+                int p = atoi(o.orderID.c_str());
+                int i = atoi(o.orderID.c_str() + colon + 1);
+                if (i <= lastFrom[p] || seen[(long long)p * perProducer + i].exchange(1)) failed = true;
+                lastFrom[p] = i;
+                consumed.fetch_add(1, memory_order_relaxed);
+            }
+        }));
+    }
+    for (size_t t = 0; t < workers.size(); t++) workers[t].join();
+    double elapsed = secondsSince(start);
+
+    for (long long i = 0; i < total; i++) {
+        if (!seen[i].load()) failed = true;
+    }
+    if (om.totalOrders() != total) failed = true;
+    cout << threads << " producers + " << threads << " consumers: " << (long long)(total / elapsed)
+         << " orders/s" << (failed ? "  FAILED" : "") << endl;
+    return !failed;
+}
+
+int main(int argc, char* argv[]) {
+    int maxThreads = argc > 1 ? atoi(argv[1]) : 32;
+    int perProducer = argc > 2 ? atoi(argv[2]) : 20000;
+    if (maxThreads < 1 || perProducer < 1) {
+        cout << "Usage: " << argv[0] << " [max threads] [orders per producer]" << endl;
+        return 1;
+    }
+    Display::useNullBackend();
+
+    for (int i = 0; i < 1000; i++) leftovers.insertTail(MenuItem("M002", "Chai", 80.0, "Drinks"));
+
+    bool ok = true;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        ok = runRound(threads, perProducer) && ok;
+    }
+    cout << (ok ? "All orders delivered exactly once" : "Order queue check FAILED") << endl;
+    return ok ? 0 : 1;
+}